@@ -23,7 +23,10 @@
 
 #include <aewt/version.hpp>
 
+#include <functional>
+
 #include <boost/version.hpp>
+#include <boost/asio/signal_set.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
 #include <boost/program_options/options_description.hpp>
@@ -42,6 +45,34 @@ int main(const int argc, const char *argv[]) {
     _push_option("remote_address", boost::program_options::value<std::string>()->default_value("localhost"));
     _push_option("remote_sessions_port", boost::program_options::value<unsigned short>()->default_value(9000));
     _push_option("remote_clients_port", boost::program_options::value<unsigned short>()->default_value(10000));
+    _push_option("anti_entropy_interval", boost::program_options::value<std::size_t>()->default_value(30));
+    _push_option("deflate_clients", boost::program_options::value<bool>()->default_value(false));
+    _push_option("deflate_sessions", boost::program_options::value<bool>()->default_value(false));
+    _push_option("deflate_window_bits", boost::program_options::value<int>()->default_value(15));
+    _push_option("deflate_level", boost::program_options::value<int>()->default_value(6));
+    _push_option("deflate_memory_level", boost::program_options::value<int>()->default_value(4));
+    _push_option("deflate_threshold", boost::program_options::value<std::size_t>()->default_value(256));
+    _push_option("deflate_no_context_takeover", boost::program_options::value<bool>()->default_value(false));
+    _push_option("batch_limit", boost::program_options::value<std::size_t>()->default_value(128));
+    _push_option("dedup_window", boost::program_options::value<std::size_t>()->default_value(30));
+    _push_option("dedup_capacity", boost::program_options::value<std::size_t>()->default_value(65536));
+    _push_option("history_size", boost::program_options::value<std::size_t>()->default_value(0));
+    _push_option("history_window", boost::program_options::value<std::size_t>()->default_value(0));
+    _push_option("history_capacity", boost::program_options::value<std::size_t>()->default_value(67108864));
+    _push_option("resume_window", boost::program_options::value<std::size_t>()->default_value(0));
+    _push_option("resume_buffer", boost::program_options::value<std::size_t>()->default_value(256));
+    _push_option("client_buffer_limit", boost::program_options::value<std::size_t>()->default_value(4096));
+    _push_option("client_rate", boost::program_options::value<std::size_t>()->default_value(0));
+    _push_option("client_burst", boost::program_options::value<std::size_t>()->default_value(64));
+    _push_option("fanout_rate", boost::program_options::value<std::size_t>()->default_value(0));
+    _push_option("fanout_burst", boost::program_options::value<std::size_t>()->default_value(16));
+    _push_option("overload_pending", boost::program_options::value<std::size_t>()->default_value(0));
+    _push_option("overload_lag", boost::program_options::value<std::size_t>()->default_value(0));
+    _push_option("monitor_interval", boost::program_options::value<std::size_t>()->default_value(1000));
+    _push_option("drain_timeout", boost::program_options::value<std::size_t>()->default_value(5000));
+    _push_option("log_level", boost::program_options::value<std::string>()->default_value("info"));
+    _push_option("log_sampling", boost::program_options::value<std::size_t>()->default_value(1));
+    _push_option("log_queue_size", boost::program_options::value<std::size_t>()->default_value(8192));
 
     boost::program_options::variables_map _vm;
     store(parse_command_line(argc, argv, _options), _vm);
@@ -56,6 +87,55 @@ int main(const int argc, const char *argv[]) {
     _server->get_config()->remote_address_ = _vm["remote_address"].as<std::string>();
     _server->get_config()->remote_sessions_port_ = _vm["remote_sessions_port"].as<unsigned short>();
     _server->get_config()->remote_clients_port_ = _vm["remote_clients_port"].as<unsigned short>();
+    _server->get_config()->anti_entropy_interval_ = _vm["anti_entropy_interval"].as<std::size_t>();
+    _server->get_config()->deflate_clients_ = _vm["deflate_clients"].as<bool>();
+    _server->get_config()->deflate_sessions_ = _vm["deflate_sessions"].as<bool>();
+    _server->get_config()->deflate_window_bits_ = _vm["deflate_window_bits"].as<int>();
+    _server->get_config()->deflate_level_ = _vm["deflate_level"].as<int>();
+    _server->get_config()->deflate_memory_level_ = _vm["deflate_memory_level"].as<int>();
+    _server->get_config()->deflate_threshold_ = _vm["deflate_threshold"].as<std::size_t>();
+    _server->get_config()->deflate_no_context_takeover_ = _vm["deflate_no_context_takeover"].as<bool>();
+    _server->get_config()->batch_limit_ = _vm["batch_limit"].as<std::size_t>();
+    _server->get_config()->dedup_window_ = _vm["dedup_window"].as<std::size_t>();
+    _server->get_config()->dedup_capacity_ = _vm["dedup_capacity"].as<std::size_t>();
+    _server->get_config()->history_size_ = _vm["history_size"].as<std::size_t>();
+    _server->get_config()->history_window_ = _vm["history_window"].as<std::size_t>();
+    _server->get_config()->history_capacity_ = _vm["history_capacity"].as<std::size_t>();
+    _server->get_config()->resume_window_ = _vm["resume_window"].as<std::size_t>();
+    _server->get_config()->resume_buffer_ = _vm["resume_buffer"].as<std::size_t>();
+    _server->get_config()->client_buffer_limit_ = _vm["client_buffer_limit"].as<std::size_t>();
+    _server->get_config()->client_rate_ = _vm["client_rate"].as<std::size_t>();
+    _server->get_config()->client_burst_ = _vm["client_burst"].as<std::size_t>();
+    _server->get_config()->fanout_rate_ = _vm["fanout_rate"].as<std::size_t>();
+    _server->get_config()->fanout_burst_ = _vm["fanout_burst"].as<std::size_t>();
+    _server->get_config()->overload_pending_ = _vm["overload_pending"].as<std::size_t>();
+    _server->get_config()->overload_lag_ = _vm["overload_lag"].as<std::size_t>();
+    _server->get_config()->monitor_interval_ = _vm["monitor_interval"].as<std::size_t>();
+    _server->get_config()->drain_timeout_ = _vm["drain_timeout"].as<std::size_t>();
+    _server->get_config()->log_level_ = _vm["log_level"].as<std::string>();
+    _server->get_config()->log_sampling_ = _vm["log_sampling"].as<std::size_t>();
+    _server->get_config()->log_queue_size_ = _vm["log_queue_size"].as<std::size_t>();
+
+    // Beast rechaza estos valores al aplicar la opción en la primera conexión, se validan antes de arrancar
+    const auto &_config = _server->get_config();
+    if (_config->deflate_window_bits_ < 9 || _config->deflate_window_bits_ > 15) {
+        fmt::print(stderr, "deflate_window_bits must be between 9 and 15, got {}\n", _config->deflate_window_bits_);
+        return 1;
+    }
+
+    if (_config->deflate_level_ < 0 || _config->deflate_level_ > 9) {
+        fmt::print(stderr, "deflate_level must be between 0 and 9, got {}\n", _config->deflate_level_);
+        return 1;
+    }
+
+    if (_config->deflate_memory_level_ < 1 || _config->deflate_memory_level_ > 9) {
+        fmt::print(stderr, "deflate_memory_level must be between 1 and 9, got {}\n", _config->deflate_memory_level_);
+        return 1;
+    }
+
+#if defined(ASYNC_LOGGING_ENABLED) && !defined(DEBUG_ENABLED)
+    aewt::logger::start(*_server->get_config());
+#endif
 
     LOG_INFO("state version: {}.{}.{}", aewt::version::get_major(), aewt::version::get_minor(),
              aewt::version::get_patch());
@@ -69,6 +149,52 @@ int main(const int argc, const char *argv[]) {
     LOG_INFO("- remote_address: {}", _vm["remote_address"].as<std::string>());
     LOG_INFO("- remote_sessions_port: {}", _vm["remote_sessions_port"].as<unsigned short>());
     LOG_INFO("- remote_clients_port: {}", _vm["remote_clients_port"].as<unsigned short>());
+    LOG_INFO("- anti_entropy_interval: {}", _vm["anti_entropy_interval"].as<std::size_t>());
+    LOG_INFO("- deflate_clients: {}", _vm["deflate_clients"].as<bool>());
+    LOG_INFO("- deflate_sessions: {}", _vm["deflate_sessions"].as<bool>());
+    LOG_INFO("- deflate_window_bits: {}", _vm["deflate_window_bits"].as<int>());
+    LOG_INFO("- deflate_threshold: {}", _vm["deflate_threshold"].as<std::size_t>());
+    LOG_INFO("- deflate_no_context_takeover: {}", _vm["deflate_no_context_takeover"].as<bool>());
+    LOG_INFO("- batch_limit: {}", _vm["batch_limit"].as<std::size_t>());
+    LOG_INFO("- dedup_window: {}", _vm["dedup_window"].as<std::size_t>());
+    LOG_INFO("- dedup_capacity: {}", _vm["dedup_capacity"].as<std::size_t>());
+    LOG_INFO("- history_size: {}", _vm["history_size"].as<std::size_t>());
+    LOG_INFO("- history_window: {}", _vm["history_window"].as<std::size_t>());
+    LOG_INFO("- history_capacity: {}", _vm["history_capacity"].as<std::size_t>());
+    LOG_INFO("- resume_window: {}", _vm["resume_window"].as<std::size_t>());
+    LOG_INFO("- resume_buffer: {}", _vm["resume_buffer"].as<std::size_t>());
+    LOG_INFO("- client_buffer_limit: {}", _vm["client_buffer_limit"].as<std::size_t>());
+    LOG_INFO("- client_rate: {}", _vm["client_rate"].as<std::size_t>());
+    LOG_INFO("- client_burst: {}", _vm["client_burst"].as<std::size_t>());
+    LOG_INFO("- fanout_rate: {}", _vm["fanout_rate"].as<std::size_t>());
+    LOG_INFO("- fanout_burst: {}", _vm["fanout_burst"].as<std::size_t>());
+    LOG_INFO("- overload_pending: {}", _vm["overload_pending"].as<std::size_t>());
+    LOG_INFO("- overload_lag: {}", _vm["overload_lag"].as<std::size_t>());
+    LOG_INFO("- monitor_interval: {}", _vm["monitor_interval"].as<std::size_t>());
+    LOG_INFO("- drain_timeout: {}", _vm["drain_timeout"].as<std::size_t>());
+    LOG_INFO("- log_level: {}", _vm["log_level"].as<std::string>());
+    LOG_INFO("- log_sampling: {}", _vm["log_sampling"].as<std::size_t>());
+
+    // Un despliegue detiene el proceso con SIGTERM, el nodo se drena antes de salir
+    boost::asio::signal_set _signals(_server->get_state()->get_ioc(), SIGINT, SIGTERM);
+    bool _stopping = false;
+    std::function<void(const boost::system::error_code &, int)> _on_signal;
+    _on_signal = [&_server, &_signals, &_on_signal, &_stopping](const boost::system::error_code &ec, int) {
+        if (ec)
+            return;
+
+        // Una segunda señal no espera el drenaje
+        if (_stopping) {
+            LOG_INFO("forced stop");
+            _server->get_state()->get_ioc().stop();
+            return;
+        }
+
+        _stopping = true;
+        _server->stop();
+        _signals.async_wait(_on_signal);
+    };
+    _signals.async_wait(_on_signal);
 
     _server->start();
 
@@ -0,0 +1,173 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#ifndef AEWT_CHANNEL_TRIE_HPP
+#define AEWT_CHANNEL_TRIE_HPP
+
+#include <boost/functional/hash.hpp>
+#include <boost/uuid/uuid.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace aewt {
+    /**
+     * Channel Trie
+     *
+     * Pattern channels split by dots, "*" matches one segment and "#" matches zero or more. A topic is matched in
+     * time proportional to its depth no matter how many patterns are stored.
+     */
+    class channel_trie {
+        /**
+         * Segment Hash
+         */
+        struct segment_hash {
+            using is_transparent = void;
+
+            std::size_t operator()(std::string_view value) const;
+        };
+
+        /**
+         * Node
+         */
+        struct node {
+            /**
+             * Children
+             */
+            std::unordered_map<std::string, std::unique_ptr<node>, segment_hash, std::equal_to<> > children_;
+
+            /**
+             * Single
+             */
+            std::unique_ptr<node> single_;
+
+            /**
+             * Multi
+             */
+            std::unique_ptr<node> multi_;
+
+            /**
+             * Sessions
+             */
+            std::unordered_set<boost::uuids::uuid, boost::hash<boost::uuids::uuid> > sessions_;
+
+            /**
+             * Is Empty
+             *
+             * @return bool
+             */
+            bool is_empty() const;
+        };
+
+        /**
+         * Root
+         */
+        node root_;
+
+        /**
+         * Size
+         */
+        std::size_t size_ = 0;
+
+        /**
+         * Erase
+         *
+         * @param current
+         * @param segments
+         * @param position
+         * @param session_id
+         * @return bool
+         */
+        bool erase(node &current, const std::vector<std::string_view> &segments, std::size_t position,
+                   const boost::uuids::uuid &session_id);
+
+        /**
+         * Match
+         *
+         * @param current
+         * @param segments
+         * @param position
+         * @param output
+         */
+        static void match(const node &current, const std::vector<std::string_view> &segments, std::size_t position,
+                          std::vector<boost::uuids::uuid> &output);
+
+    public:
+        /**
+         * Is Pattern
+         *
+         * @param channel
+         * @return bool
+         */
+        static bool is_pattern(std::string_view channel);
+
+        /**
+         * Matches
+         *
+         * Checks a single pattern without a trie, for the few patterns of one client.
+         *
+         * @param pattern
+         * @param topic
+         * @return bool
+         */
+        static bool matches(std::string_view pattern, std::string_view topic);
+
+        /**
+         * Insert
+         *
+         * @param pattern
+         * @param session_id
+         * @return bool
+         */
+        bool insert(std::string_view pattern, const boost::uuids::uuid &session_id);
+
+        /**
+         * Erase
+         *
+         * Empty branches are pruned so withdrawn patterns do not slow down matching.
+         *
+         * @param pattern
+         * @param session_id
+         * @return bool
+         */
+        bool erase(std::string_view pattern, const boost::uuids::uuid &session_id);
+
+        /**
+         * Match
+         *
+         * A session may be reported more than once when several of its patterns match.
+         *
+         * @param topic
+         * @param output
+         */
+        void match(std::string_view topic, std::vector<boost::uuids::uuid> &output) const;
+
+        /**
+         * Get Size
+         *
+         * @return size_t
+         */
+        std::size_t get_size() const;
+    };
+} // namespace aewt
+
+#endif  // AEWT_CHANNEL_TRIE_HPP
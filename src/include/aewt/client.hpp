@@ -18,12 +18,19 @@
 #ifndef AEWT_CLIENT_HPP
 #define AEWT_CLIENT_HPP
 
+#include <atomic>
+#include <deque>
 #include <memory>
+#include <mutex>
+
+#include <aewt/message.hpp>
 #include <boost/uuid/uuid.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/json/object.hpp>
 
 #include <boost/beast/core.hpp>
+#include <boost/beast/http.hpp>
 #include <boost/beast/websocket.hpp>
 #include <boost/uuid/random_generator.hpp>
 
@@ -101,6 +108,13 @@ namespace aewt {
          */
         bool get_is_local() const;
 
+        /**
+         * Get No Ack
+         *
+         * @return bool
+         */
+        bool get_no_ack() const;
+
         /**
          * Run
          */
@@ -111,7 +125,14 @@ namespace aewt {
          *
          * @param data
          */
-        void send(std::shared_ptr<std::string const> const &data);
+        void send(message const &data);
+
+        /**
+         * Close
+         *
+         * Sends a going away close frame, messages sent afterwards are dropped.
+         */
+        void close();
 
         /**
          * Set Socket
@@ -120,27 +141,153 @@ namespace aewt {
          */
         void set_socket(boost::asio::ip::tcp::socket &&socket);
 
+        /**
+         * Resume
+         *
+         * Takes over the connection of a reconnect that presented the token of this parked client, the handshake
+         * continues here keeping the id and subscriptions.
+         *
+         * @param socket
+         * @param upgrade
+         * @param buffer
+         * @param run_at
+         */
+        void resume(boost::asio::ip::tcp::socket &&socket,
+                    boost::beast::http::request<boost::beast::http::string_body> &&upgrade,
+                    boost::beast::flat_buffer &&buffer, long run_at);
+
     private:
         /**
          * Socket
          */
         std::optional<boost::beast::websocket::stream<boost::beast::tcp_stream> > socket_;
 
+        /**
+         * Closing
+         */
+        bool closing_ = false;
+
         /**
          * Buffer
          */
         boost::beast::flat_buffer buffer_;
 
+        /**
+         * Upgrade
+         */
+        boost::beast::http::request<boost::beast::http::string_body> upgrade_;
+
+        /**
+         * No Ack
+         *
+         * Negotiated on the upgrade with the no_ack query param, successful requests get no ack unless they ask for it.
+         */
+        bool no_ack_ = false;
+
         /**
          * Queue
          */
-        std::vector<std::shared_ptr<std::string const> > queue_;
+        std::vector<message> queue_;
+
+        /**
+         * Writing
+         *
+         * The front of the queue is being written, its buffer must outlive the write even if the connection changed.
+         */
+        bool writing_ = false;
+
+        /**
+         * Resume Mutex
+         *
+         * Guards the parked queue, sends arrive from any thread.
+         */
+        std::mutex resume_mutex_;
+
+        /**
+         * Parked
+         *
+         * Checked before taking the resume mutex, only a parked client pays for the lock.
+         */
+        std::atomic<bool> parked_ = false;
+
+        /**
+         * Executor
+         *
+         * Executor of the socket, a resumed connection keeps it.
+         */
+        boost::asio::any_io_executor executor_;
+
+        /**
+         * Parked Queue
+         *
+         * Messages received while parked, bounded by the resume buffer.
+         */
+        std::deque<message> parked_queue_;
+
+        /**
+         * Dropped
+         */
+        std::size_t dropped_ = 0;
+
+        /**
+         * Resumed
+         */
+        bool resumed_ = false;
+
+        /**
+         * Resume Token
+         */
+        boost::uuids::uuid resume_token_{};
+
+        /**
+         * Generation
+         *
+         * Increased when parked so the completions of the previous connection are ignored.
+         */
+        std::atomic<std::size_t> generation_ = 0;
+
+        /**
+         * Expiry
+         *
+         * Timer of the resume window while parked.
+         */
+        std::shared_ptr<boost::asio::steady_timer> expiry_;
 
         /**
         * On Run
         */
         void on_run();
 
+        /**
+         * On Upgrade
+         *
+         * @param run_at
+         * @param ec
+         * @param bytes_transferred
+         */
+        void on_upgrade(long run_at, const boost::beast::error_code &ec, std::size_t bytes_transferred);
+
+        /**
+         * Do Resume
+         *
+         * Runs on the executor of the parked connection so its pending handlers never overlap the new one.
+         *
+         * @param socket
+         * @param upgrade
+         * @param buffer
+         * @param run_at
+         */
+        void do_resume(boost::asio::ip::tcp::socket &socket,
+                       boost::beast::http::request<boost::beast::http::string_body> &upgrade,
+                       boost::beast::flat_buffer &buffer, long run_at);
+
+        /**
+         * Do Accept
+         *
+         * @param run_at
+         */
+        void do_accept(long run_at);
+
         /**
          * On Accept
          *
@@ -162,20 +309,64 @@ namespace aewt {
          */
         void on_read(const boost::system::error_code &ec, std::size_t bytes_transferred);
 
+        /**
+         * Do Close
+         */
+        void do_close();
+
+        /**
+         * On Close
+         *
+         * @param ec
+         */
+        void on_close(const boost::beast::error_code &ec);
+
         /**
          * On Send
          *
          * @param data
          */
-        void on_send(std::shared_ptr<std::string const> const &data);
+        void on_send(message const &data);
+
+        /**
+         * Do Write
+         */
+        void do_write();
 
         /**
          * On Write
          *
+         * @param generation
          * @param ec
          * @param bytes_transferred
          */
-        void on_write(const boost::beast::error_code &ec, std::size_t bytes_transferred);
+        void on_write(std::size_t generation, const boost::beast::error_code &ec, std::size_t bytes_transferred);
+
+        /**
+         * Do Park
+         *
+         * Keeps the client registered after its socket dropped, waiting for a reconnect with the resume token.
+         */
+        void do_park();
+
+        /**
+         * Push Parked
+         *
+         * Requires the resume mutex.
+         *
+         * @param data
+         */
+        void push_parked(message const &data);
+
+        /**
+         * On Expire
+         *
+         * @param timer
+         * @param token
+         * @param ec
+         */
+        void on_expire(const std::shared_ptr<boost::asio::steady_timer> &timer, boost::uuids::uuid token,
+                       const boost::system::error_code &ec);
     };
 } // namespace aewt
 
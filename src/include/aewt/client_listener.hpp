@@ -40,6 +40,8 @@ namespace aewt {
         void do_accept();
 
         void start();
+
+        void stop();
     };
 } // namespace aewt
 
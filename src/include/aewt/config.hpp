@@ -20,6 +20,7 @@
 
 #include <string>
 #include <atomic>
+#include <cstddef>
 
 namespace aewt {
     struct config {
@@ -72,6 +73,194 @@ namespace aewt {
          * REPL Enabled
          */
         bool repl_enabled = true;
+
+        /**
+         * Sync Batch Size
+         */
+        std::size_t sync_batch_size_ = 1024;
+
+        /**
+         * Anti Entropy Interval
+         *
+         * Seconds between digests sent to peers, 0 disables the reconciliation.
+         */
+        std::size_t anti_entropy_interval_ = 30;
+
+        /**
+         * Deflate Clients
+         */
+        bool deflate_clients_ = false;
+
+        /**
+         * Deflate Sessions
+         */
+        bool deflate_sessions_ = false;
+
+        /**
+         * Deflate Window Bits
+         *
+         * From 9 to 15, zlib does not support 8.
+         */
+        int deflate_window_bits_ = 15;
+
+        /**
+         * Deflate Level
+         */
+        int deflate_level_ = 6;
+
+        /**
+         * Deflate Memory Level
+         */
+        int deflate_memory_level_ = 4;
+
+        /**
+         * Deflate Threshold
+         *
+         * Messages below this size in bytes are sent uncompressed.
+         */
+        std::size_t deflate_threshold_ = 256;
+
+        /**
+         * Deflate No Context Takeover
+         *
+         * Resets the server compressor after every message, trading ratio for per connection memory.
+         */
+        bool deflate_no_context_takeover_ = false;
+
+        /**
+         * Batch Limit
+         *
+         * Requests a single batch may wrap.
+         */
+        std::size_t batch_limit_ = 128;
+
+        /**
+         * Dedup Window
+         *
+         * Seconds an ack of publish, broadcast or send is replayed for a retried transaction, 0 disables it.
+         */
+        std::size_t dedup_window_ = 30;
+
+        /**
+         * Dedup Capacity
+         */
+        std::size_t dedup_capacity_ = 65536;
+
+        /**
+         * History Size
+         *
+         * Publications kept per channel for subscribers catching up, 0 disables the history.
+         */
+        std::size_t history_size_ = 0;
+
+        /**
+         * History Window
+         *
+         * Seconds a publication is kept, 0 keeps it until the size or the capacity evicts it.
+         */
+        std::size_t history_window_ = 0;
+
+        /**
+         * History Capacity
+         *
+         * Bytes kept across every channel, the least recently used channels are evicted first.
+         */
+        std::size_t history_capacity_ = 67108864;
+
+        /**
+         * Resume Window
+         *
+         * Seconds a dropped client keeps its id and subscriptions waiting for a reconnect with its token, 0 disables
+         * the resumption.
+         */
+        std::size_t resume_window_ = 0;
+
+        /**
+         * Resume Buffer
+         *
+         * Messages kept for a parked client, the oldest are dropped beyond it.
+         */
+        std::size_t resume_buffer_ = 256;
+
+        /**
+         * Client Buffer Limit
+         *
+         * Read buffers of clients above this capacity in bytes are released once the message is handled.
+         */
+        std::size_t client_buffer_limit_ = 4096;
+
+        /**
+         * Client Rate
+         *
+         * Requests per second a client may send, 0 disables the limit.
+         */
+        std::size_t client_rate_ = 0;
+
+        /**
+         * Client Burst
+         */
+        std::size_t client_burst_ = 64;
+
+        /**
+         * Fanout Rate
+         *
+         * Publish, broadcast, send and batch requests per second a client may send, 0 disables the limit.
+         */
+        std::size_t fanout_rate_ = 0;
+
+        /**
+         * Fanout Burst
+         */
+        std::size_t fanout_burst_ = 16;
+
+        /**
+         * Overload Pending
+         *
+         * Messages waiting in outbound queues above which the fan-out requests of clients are shed, 0 disables the
+         * shedding.
+         */
+        std::size_t overload_pending_ = 0;
+
+        /**
+         * Overload Lag
+         *
+         * Scheduling lag in milliseconds above which the fan-out requests of clients are shed, 0 disables it.
+         */
+        std::size_t overload_lag_ = 0;
+
+        /**
+         * Monitor Interval
+         *
+         * Milliseconds between samples of the io threads, 0 disables the monitor.
+         */
+        std::size_t monitor_interval_ = 1000;
+
+        /**
+         * Drain Timeout
+         *
+         * Milliseconds a stopping node waits for its queues to flush and its connections to close, 0 stops at once.
+         */
+        std::size_t drain_timeout_ = 5000;
+
+        /**
+         * Log Level
+         */
+        std::string log_level_ = "info";
+
+        /**
+         * Log Sampling
+         */
+        std::size_t log_sampling_ = 1;
+
+        /**
+         * Log Queue Size
+         */
+        std::size_t log_queue_size_ = 8192;
+
+        /**
+         * Log Threads
+         */
+        std::size_t log_threads_ = 1;
     };
 } // namespace aewt
 
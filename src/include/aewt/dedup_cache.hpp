@@ -0,0 +1,163 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#ifndef AEWT_DEDUP_CACHE_HPP
+#define AEWT_DEDUP_CACHE_HPP
+
+#include <boost/json/object.hpp>
+#include <boost/uuid/uuid.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace aewt {
+    /**
+     * Forward Config
+     */
+    struct config;
+
+    /**
+     * Dedup Cache
+     *
+     * Remembers the acks of retryable requests by entity and transaction so a retry inside the window gets the
+     * same ack without running the fan-out again. Keys are spread over independently locked shards.
+     */
+    class dedup_cache {
+        /**
+         * Key
+         */
+        using key = std::pair<boost::uuids::uuid, boost::uuids::uuid>;
+
+        /**
+         * Key Hash
+         */
+        struct key_hash {
+            std::size_t operator()(const key &value) const;
+        };
+
+        /**
+         * Entry
+         */
+        struct entry {
+            /**
+             * Data
+             */
+            boost::json::object data_;
+
+            /**
+             * Stored At
+             */
+            std::chrono::steady_clock::time_point stored_at_;
+        };
+
+        /**
+         * Shard
+         */
+        struct shard {
+            /**
+             * Mutex
+             */
+            std::mutex mutex_;
+
+            /**
+             * Entries
+             */
+            std::unordered_map<key, entry, key_hash> entries_;
+
+            /**
+             * Order
+             *
+             * Keys with their store time in insertion order, the oldest is evicted first. A key stored again is
+             * appended anew and its previous position no longer matches.
+             */
+            std::deque<std::pair<key, std::chrono::steady_clock::time_point> > order_;
+        };
+
+        /**
+         * Shards Count
+         */
+        static constexpr std::size_t shards_count = 16;
+
+        /**
+         * Config
+         */
+        std::shared_ptr<config> config_;
+
+        /**
+         * Shards
+         */
+        std::array<shard, shards_count> shards_;
+
+        /**
+         * Get Shard
+         *
+         * @param value
+         * @return shard
+         */
+        shard &get_shard(const key &value);
+
+        /**
+         * Evict
+         *
+         * @param shard
+         * @param now
+         */
+        void evict(shard &shard, std::chrono::steady_clock::time_point now) const;
+
+    public:
+        /**
+         * Constructor
+         *
+         * @param config
+         */
+        explicit dedup_cache(const std::shared_ptr<config> &config);
+
+        /**
+         * Find
+         *
+         * @param entity_id
+         * @param transaction_id
+         * @return optional<object>
+         */
+        std::optional<boost::json::object> find(boost::uuids::uuid entity_id, boost::uuids::uuid transaction_id);
+
+        /**
+         * Insert
+         *
+         * @param entity_id
+         * @param transaction_id
+         * @param data
+         */
+        void insert(boost::uuids::uuid entity_id, boost::uuids::uuid transaction_id, const boost::json::object &data);
+
+        /**
+         * Get Size
+         *
+         * @return size_t
+         */
+        std::size_t get_size();
+    };
+} // namespace aewt
+
+#endif  // AEWT_DEDUP_CACHE_HPP
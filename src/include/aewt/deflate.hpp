@@ -0,0 +1,41 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#ifndef AEWT_DEFLATE_HPP
+#define AEWT_DEFLATE_HPP
+
+#include <boost/beast/websocket/option.hpp>
+
+namespace aewt {
+    /**
+     * Forward Config
+     */
+    struct config;
+
+    /**
+     * Get Deflate Options
+     *
+     * Builds the permessage-deflate offer for a listener, the extension is only used when the peer negotiates it.
+     *
+     * @param config
+     * @param enabled
+     * @return permessage_deflate
+     */
+    boost::beast::websocket::permessage_deflate get_deflate_options(const config &config, bool enabled);
+} // namespace aewt
+
+#endif  // AEWT_DEFLATE_HPP
@@ -0,0 +1,135 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#ifndef AEWT_DRAINER_HPP
+#define AEWT_DRAINER_HPP
+
+#include <chrono>
+#include <memory>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/beast/core.hpp>
+
+namespace aewt {
+    /**
+     * Forward State
+     */
+    class state;
+
+    /**
+     * Forward Session Listener
+     */
+    class session_listener;
+
+    /**
+     * Forward Client Listener
+     */
+    class client_listener;
+
+    /**
+     * Drainer
+     *
+     * Takes the node out of the cluster before stopping it: closes the listeners, tells the peers, waits for the
+     * outbound queues to flush, closes every connection and stops the io context once they are gone or the
+     * deadline is reached.
+     */
+    class drainer : public std::enable_shared_from_this<drainer> {
+        /**
+         * State
+         */
+        std::shared_ptr<state> state_;
+
+        /**
+         * Session Listener
+         */
+        std::shared_ptr<session_listener> session_listener_;
+
+        /**
+         * Client Listener
+         */
+        std::shared_ptr<client_listener> client_listener_;
+
+        /**
+         * Timer
+         */
+        boost::asio::steady_timer timer_;
+
+        /**
+         * Deadline
+         */
+        std::chrono::steady_clock::time_point deadline_;
+
+        /**
+         * Closing
+         */
+        bool closing_ = false;
+
+        /**
+         * Expired
+         */
+        bool expired_ = false;
+
+    public:
+        /**
+         * Constructor
+         *
+         * @param ioc
+         * @param state
+         * @param session_listener
+         * @param client_listener
+         */
+        drainer(boost::asio::io_context &ioc, const std::shared_ptr<state> &state,
+                const std::shared_ptr<session_listener> &session_listener,
+                const std::shared_ptr<client_listener> &client_listener);
+
+        /**
+         * Start
+         */
+        void start();
+
+    private:
+        /**
+         * On Start
+         */
+        void on_start();
+
+        /**
+         * Do Wait
+         */
+        void do_wait();
+
+        /**
+         * On Wait
+         *
+         * @param ec
+         */
+        void on_wait(const boost::beast::error_code &ec);
+
+        /**
+         * Do Close
+         */
+        void do_close();
+
+        /**
+         * Do Stop
+         */
+        void do_stop();
+    };
+} // namespace aewt
+
+#endif  // AEWT_DRAINER_HPP
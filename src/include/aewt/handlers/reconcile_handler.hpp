@@ -0,0 +1,37 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#ifndef AEWT_HANDLERS_RECONCILE_HANDLER_HPP
+#define AEWT_HANDLERS_RECONCILE_HANDLER_HPP
+
+namespace aewt {
+    /**
+     * Forward Request
+     */
+    struct request;
+
+    namespace handlers {
+        /**
+         * Reconcile Handler
+         *
+         * @param request
+         */
+        void reconcile_handler(const request& request);
+    }
+} // namespace aewt
+
+#endif  // AEWT_HANDLERS_RECONCILE_HANDLER_HPP
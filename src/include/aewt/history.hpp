@@ -0,0 +1,186 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#ifndef AEWT_HISTORY_HPP
+#define AEWT_HISTORY_HPP
+
+#include <aewt/message.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace aewt {
+    /**
+     * Forward Config
+     */
+    struct config;
+
+    /**
+     * History
+     *
+     * Keeps the last serialized publications of every channel so a subscriber can catch up from a sequence without
+     * going to its database. Sequences are global and increasing, the memory of all channels is capped together
+     * evicting the least recently used channel first.
+     */
+    class history {
+        /**
+         * Record
+         */
+        struct record {
+            /**
+             * Sequence
+             */
+            std::uint64_t sequence_;
+
+            /**
+             * Stored At
+             */
+            std::chrono::steady_clock::time_point stored_at_;
+
+            /**
+             * Data
+             */
+            message data_;
+        };
+
+        /**
+         * Ring
+         */
+        struct ring {
+            /**
+             * Records
+             */
+            std::deque<record> records_;
+
+            /**
+             * Position
+             *
+             * Place of the channel in the recency order.
+             */
+            std::list<std::string>::iterator position_;
+        };
+
+        /**
+         * Config
+         */
+        std::shared_ptr<config> config_;
+
+        /**
+         * Mutex
+         */
+        std::mutex mutex_;
+
+        /**
+         * Sequence
+         */
+        std::uint64_t sequence_ = 0;
+
+        /**
+         * Rings
+         */
+        std::unordered_map<std::string, ring> rings_;
+
+        /**
+         * Order
+         *
+         * Channels from the most to the least recently used.
+         */
+        std::list<std::string> order_;
+
+        /**
+         * Bytes
+         */
+        std::size_t bytes_ = 0;
+
+        /**
+         * Evict
+         *
+         * @param ring
+         * @param now
+         */
+        void evict(ring &ring, std::chrono::steady_clock::time_point now);
+
+        /**
+         * Collect
+         *
+         * @param ring
+         * @param since
+         * @param output
+         */
+        static void collect(const ring &ring, std::uint64_t since, std::vector<record> &output);
+
+    public:
+        /**
+         * Constructor
+         *
+         * @param config
+         */
+        explicit history(const std::shared_ptr<config> &config);
+
+        /**
+         * Get Enabled
+         *
+         * @return bool
+         */
+        bool get_enabled() const;
+
+        /**
+         * Next Sequence
+         *
+         * @return uint64_t
+         */
+        std::uint64_t next_sequence();
+
+        /**
+         * Push
+         *
+         * @param channel
+         * @param sequence
+         * @param data
+         */
+        void push(const std::string &channel, std::uint64_t sequence, const message &data);
+
+        /**
+         * Replay
+         *
+         * Publications after the given sequence in order, a pattern collects every channel it matches.
+         *
+         * @param channel
+         * @param since
+         * @return vector<message>
+         */
+        std::vector<message> replay(const std::string &channel, std::uint64_t since);
+
+        /**
+         * Get Bytes
+         *
+         * @return size_t
+         */
+        std::size_t get_bytes();
+    };
+} // namespace aewt
+
+#endif  // AEWT_HISTORY_HPP
@@ -0,0 +1,50 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#ifndef AEWT_INTEREST_HPP
+#define AEWT_INTEREST_HPP
+
+#include <boost/uuid/uuid.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace aewt {
+    /**
+     * Interest
+     *
+     * Aggregates the subscribers of a session on a channel, remote clients are not tracked one by one.
+     */
+    struct interest {
+        /**
+         * Session ID
+         */
+        boost::uuids::uuid session_id_;
+
+        /**
+         * Channel
+         */
+        std::string channel_;
+
+        /**
+         * Count
+         */
+        std::size_t count_ = 1;
+    };
+} // namespace aewt
+
+#endif  // AEWT_INTEREST_HPP
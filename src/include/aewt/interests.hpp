@@ -0,0 +1,75 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#ifndef AEWT_INTERESTS_HPP
+#define AEWT_INTERESTS_HPP
+
+#include <aewt/interest.hpp>
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/composite_key.hpp>
+
+#include <boost/uuid/uuid.hpp>
+
+namespace aewt {
+    /**
+     * Interests By Session
+     */
+    struct interests_by_session {
+    };
+
+    /**
+     * Interests By Channel
+     */
+    struct interests_by_channel {
+    };
+
+    /**
+     * Interests By Session Channel
+     */
+    struct interests_by_session_channel {
+    };
+
+    /**
+     * Interests
+     */
+    using interests = boost::multi_index::multi_index_container<
+        interest,
+        boost::multi_index::indexed_by<
+            boost::multi_index::ordered_non_unique<
+                boost::multi_index::tag<interests_by_session>,
+                boost::multi_index::member<interest, boost::uuids::uuid, &interest::session_id_>
+            >,
+            boost::multi_index::ordered_non_unique<
+                boost::multi_index::tag<interests_by_channel>,
+                boost::multi_index::member<interest, std::string, &interest::channel_>
+            >,
+            boost::multi_index::ordered_unique<
+                boost::multi_index::tag<interests_by_session_channel>,
+                boost::multi_index::composite_key<
+                    interest,
+                    boost::multi_index::member<interest, boost::uuids::uuid, &interest::session_id_>,
+                    boost::multi_index::member<interest, std::string, &interest::channel_>
+                >
+            >
+        >
+    >;
+} // namespace aewt
+
+#endif  // AEWT_INTERESTS_HPP
@@ -56,6 +56,20 @@ namespace aewt {
      */
     std::shared_ptr<response> kernel(const std::shared_ptr<state> &state,
                                      const boost::json::object &data, kernel_context context, boost::uuids::uuid entity_id);
+
+    /**
+     * Kernel
+     *
+     * Writes into a response owned by the caller, used by the connections to keep the read path off the heap.
+     *
+     * @param state
+     * @param data
+     * @param context
+     * @param entity_id
+     * @param response
+     */
+    void kernel(const std::shared_ptr<state> &state, const boost::json::object &data, kernel_context context,
+                boost::uuids::uuid entity_id, response &response);
 } // namespace aewt
 
 #endif  // AEWT_KERNEL_HPP
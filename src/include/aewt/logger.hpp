@@ -5,8 +5,94 @@
 
 #include <spdlog/spdlog.h>
 
-#ifdef DEBUG_ENABLED
+#include <boost/uuid/uuid.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace aewt {
+    /**
+     * Forward Config
+     */
+    struct config;
+
+    namespace logger {
+        /**
+         * Start
+         *
+         * Replaces the default logger with an asynchronous one backed by a bounded queue. When the queue is full
+         * the oldest message is dropped so the io threads never block on logging. Only the sink I/O leaves the
+         * calling thread, spdlog still formats the message there, uuids included.
+         *
+         * @param config
+         */
+        void start(const config &config);
+
+        /**
+         * Set Level
+         *
+         * @param level
+         * @return bool
+         */
+        bool set_level(const std::string &level);
+
+        /**
+         * Set Sampling
+         *
+         * Keeps one message out of every rate messages per thread, 0 and 1 keep everything.
+         *
+         * @param rate
+         */
+        void set_sampling(std::size_t rate);
+
+        /**
+         * Get Sampling
+         *
+         * @return size_t
+         */
+        std::size_t get_sampling();
+
+        /**
+         * Should Log
+         *
+         * @return bool
+         */
+        bool should_log();
+    }
+} // namespace aewt
+
+/**
+ * UUID Formatter
+ *
+ * Writes the uuid straight into the output buffer so log calls can take ids without building a string first.
+ */
+template<>
+struct fmt::formatter<boost::uuids::uuid> : fmt::formatter<fmt::string_view> {
+    template<typename FormatContext>
+    auto format(const boost::uuids::uuid &id, FormatContext &context) const {
+        constexpr char _digits[] = "0123456789abcdef";
+
+        char _buffer[36];
+        auto *_output = _buffer;
+        std::size_t _position = 0;
+
+        for (const auto _byte: id) {
+            if (_position == 4 || _position == 6 || _position == 8 || _position == 10)
+                *_output++ = '-';
+
+            *_output++ = _digits[_byte >> 4];
+            *_output++ = _digits[_byte & 0x0f];
+            ++_position;
+        }
+
+        return fmt::formatter<fmt::string_view>::format(fmt::string_view(_buffer, sizeof(_buffer)), context);
+    }
+};
+
+#if defined(DEBUG_ENABLED)
 #define LOG_INFO(...) spdlog::info(__VA_ARGS__)
+#elif defined(ASYNC_LOGGING_ENABLED)
+#define LOG_INFO(...) do { if (aewt::logger::should_log()) spdlog::info(__VA_ARGS__); } while (false)
 #else
     #define LOG_INFO(...) ((void)0)
 #endif
@@ -0,0 +1,220 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#ifndef AEWT_LOOP_MONITOR_HPP
+#define AEWT_LOOP_MONITOR_HPP
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/beast/core.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace aewt {
+    /**
+     * Forward Config
+     */
+    struct config;
+
+    /**
+     * Forward Overload Detector
+     */
+    class overload_detector;
+
+    /**
+     * Loop Monitor
+     *
+     * Runs the io threads counting the handlers each one completes and arms one timer per thread whose delay
+     * measures how late the reactor schedules work. Every interval the counters become a sample per thread.
+     */
+    class loop_monitor {
+    public:
+        /**
+         * Thread Stats
+         */
+        struct thread_stats {
+            /**
+             * Lag
+             *
+             * Largest delay of a timer run by the thread during the interval.
+             */
+            std::chrono::microseconds lag_{0};
+
+            /**
+             * Handlers Per Second
+             */
+            double handlers_per_second_ = 0;
+
+            /**
+             * Busy
+             *
+             * Share of the interval the thread spent on the cpu, from 0 to 1.
+             */
+            double busy_ = 0;
+        };
+
+    private:
+        /**
+         * Slot
+         */
+        struct slot {
+            /**
+             * Handlers
+             */
+            std::atomic<std::size_t> handlers_ = 0;
+
+            /**
+             * Lag
+             *
+             * Microseconds, the largest since the last sample.
+             */
+            std::atomic<std::int64_t> lag_ = 0;
+
+            /**
+             * Running
+             */
+            std::atomic<bool> running_ = false;
+
+            /**
+             * Clock
+             */
+            clockid_t clock_{};
+
+            /**
+             * Sampled Handlers
+             */
+            std::size_t sampled_handlers_ = 0;
+
+            /**
+             * Sampled Cpu
+             */
+            std::chrono::nanoseconds sampled_cpu_{0};
+        };
+
+        /**
+         * IO Context
+         */
+        boost::asio::io_context &ioc_;
+
+        /**
+         * Config
+         */
+        std::shared_ptr<config> config_;
+
+        /**
+         * Overload Detector
+         */
+        overload_detector &overload_detector_;
+
+        /**
+         * Slots
+         */
+        std::vector<std::unique_ptr<slot> > slots_;
+
+        /**
+         * Timers
+         */
+        std::vector<std::unique_ptr<boost::asio::steady_timer> > timers_;
+
+        /**
+         * Sampled At
+         */
+        std::chrono::steady_clock::time_point sampled_at_;
+
+        /**
+         * Stats
+         */
+        std::vector<thread_stats> stats_;
+
+        /**
+         * Stats Mutex
+         */
+        mutable std::mutex stats_mutex_;
+
+        /**
+         * Do Wait
+         *
+         * @param index
+         */
+        void do_wait(std::size_t index);
+
+        /**
+         * On Wait
+         *
+         * @param index
+         * @param ec
+         */
+        void on_wait(std::size_t index, const boost::beast::error_code &ec);
+
+        /**
+         * Sample
+         */
+        void sample();
+
+    public:
+        /**
+         * Constructor
+         *
+         * @param ioc
+         * @param config
+         * @param overload_detector
+         */
+        loop_monitor(boost::asio::io_context &ioc, const std::shared_ptr<config> &config,
+                     overload_detector &overload_detector);
+
+        /**
+         * Get Enabled
+         *
+         * @return bool
+         */
+        bool get_enabled() const;
+
+        /**
+         * Start
+         *
+         * Allocates a slot and arms a timer per thread, must be called before the threads run.
+         *
+         * @param threads
+         */
+        void start(std::size_t threads);
+
+        /**
+         * Run
+         *
+         * Runs the io context on the calling thread as the given slot.
+         *
+         * @param index
+         */
+        void run(std::size_t index);
+
+        /**
+         * Get Stats
+         *
+         * @return vector<thread_stats>
+         */
+        std::vector<thread_stats> get_stats() const;
+    };
+} // namespace aewt
+
+#endif  // AEWT_LOOP_MONITOR_HPP
@@ -0,0 +1,145 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#ifndef AEWT_MESSAGE_HPP
+#define AEWT_MESSAGE_HPP
+
+#include <boost/asio/buffer.hpp>
+#include <boost/json/object.hpp>
+
+#include <cstddef>
+#include <string_view>
+
+namespace aewt {
+    /**
+     * Message
+     *
+     * Immutable outbound payload shared by every recipient. The counter and the bytes live in a single block drawn
+     * from the size-class pool, copies only touch the counter.
+     */
+    class message {
+        /**
+         * Block
+         */
+        struct block;
+
+        /**
+         * Block
+         */
+        block *block_ = nullptr;
+
+        /**
+         * Release
+         */
+        void release() noexcept;
+
+    public:
+        /**
+         * Constructor
+         */
+        message() = default;
+
+        /**
+         * Constructor
+         *
+         * @param data
+         */
+        explicit message(std::string_view data);
+
+        /**
+         * Copy Constructor
+         *
+         * @param other
+         */
+        message(const message &other) noexcept;
+
+        /**
+         * Move Constructor
+         *
+         * @param other
+         */
+        message(message &&other) noexcept;
+
+        /**
+         * Copy Assignment
+         *
+         * @param other
+         * @return message
+         */
+        message &operator=(const message &other) noexcept;
+
+        /**
+         * Move Assignment
+         *
+         * @param other
+         * @return message
+         */
+        message &operator=(message &&other) noexcept;
+
+        /**
+         * Destructor
+         */
+        ~message();
+
+        /**
+         * Get Data
+         *
+         * @return const char *
+         */
+        const char *get_data() const;
+
+        /**
+         * Get Size
+         *
+         * @return size_t
+         */
+        std::size_t get_size() const;
+
+        /**
+         * Get View
+         *
+         * @return string_view
+         */
+        std::string_view get_view() const;
+
+        /**
+         * Get Buffer
+         *
+         * @return const_buffer
+         */
+        boost::asio::const_buffer get_buffer() const;
+
+        /**
+         * Get Use Count
+         *
+         * @return size_t
+         */
+        std::size_t get_use_count() const;
+    };
+
+    /**
+     * Make Message
+     *
+     * Serializes through a per thread scratch buffer so the only allocation is the message block.
+     *
+     * @param data
+     * @return message
+     */
+    message make_message(const boost::json::object &data);
+} // namespace aewt
+
+#endif  // AEWT_MESSAGE_HPP
@@ -0,0 +1,109 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#ifndef AEWT_OVERLOAD_DETECTOR_HPP
+#define AEWT_OVERLOAD_DETECTOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace aewt {
+    /**
+     * Forward Config
+     */
+    struct config;
+
+    /**
+     * Overload Detector
+     *
+     * Counts the messages waiting in the outbound queues of clients and sessions and keeps the scheduling lag of
+     * the last loop sample, the node is overloaded while either is above its configured limit.
+     */
+    class overload_detector {
+        /**
+         * Config
+         */
+        std::shared_ptr<config> config_;
+
+        /**
+         * Pending
+         */
+        std::atomic<std::size_t> pending_ = 0;
+
+        /**
+         * Lag
+         *
+         * Microseconds.
+         */
+        std::atomic<std::int64_t> lag_ = 0;
+
+    public:
+        /**
+         * Constructor
+         *
+         * @param config
+         */
+        explicit overload_detector(const std::shared_ptr<config> &config);
+
+        /**
+         * On Enqueued
+         *
+         * @param count
+         */
+        void on_enqueued(std::size_t count = 1);
+
+        /**
+         * On Dequeued
+         *
+         * @param count
+         */
+        void on_dequeued(std::size_t count = 1);
+
+        /**
+         * Get Pending
+         *
+         * @return size_t
+         */
+        std::size_t get_pending() const;
+
+        /**
+         * Set Lag
+         *
+         * @param lag
+         */
+        void set_lag(std::chrono::microseconds lag);
+
+        /**
+         * Get Lag
+         *
+         * @return microseconds
+         */
+        std::chrono::microseconds get_lag() const;
+
+        /**
+         * Get Overloaded
+         *
+         * @return bool
+         */
+        bool get_overloaded() const;
+    };
+} // namespace aewt
+
+#endif  // AEWT_OVERLOAD_DETECTOR_HPP
@@ -0,0 +1,56 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#ifndef AEWT_POOL_HPP
+#define AEWT_POOL_HPP
+
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace aewt {
+    /**
+     * Get Pool Resource
+     *
+     * Process wide size-class pool, objects can be released from any io thread.
+     *
+     * @return memory_resource
+     */
+    std::pmr::memory_resource *get_pool_resource();
+
+    /**
+     * Make Pooled
+     *
+     * Allocates the object and its control block from the pool when object pools are enabled at build time.
+     *
+     * @tparam T
+     * @tparam Args
+     * @param args
+     * @return shared_ptr<T>
+     */
+    template<typename T, typename... Args>
+    std::shared_ptr<T> make_pooled(Args &&... args) {
+#if defined(OBJECT_POOLS_ENABLED)
+        return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(get_pool_resource()),
+                                       std::forward<Args>(args)...);
+#else
+        return std::make_shared<T>(std::forward<Args>(args)...);
+#endif
+    }
+} // namespace aewt
+
+#endif  // AEWT_POOL_HPP
@@ -0,0 +1,164 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#ifndef AEWT_RATE_LIMITER_HPP
+#define AEWT_RATE_LIMITER_HPP
+
+#include <boost/functional/hash.hpp>
+#include <boost/uuid/uuid.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace aewt {
+    /**
+     * Forward Config
+     */
+    struct config;
+
+    /**
+     * Rate Limiter
+     *
+     * Token buckets per client, one for every request and one for the requests that fan out. Entities are spread
+     * over independently locked shards so a rejection only costs a lookup and a lock.
+     */
+    class rate_limiter {
+        /**
+         * Bucket
+         */
+        struct bucket {
+            /**
+             * Tokens
+             */
+            double tokens_ = 0;
+
+            /**
+             * Updated At
+             */
+            std::chrono::steady_clock::time_point updated_at_;
+
+            /**
+             * Try Take
+             *
+             * @param rate
+             * @param burst
+             * @param now
+             * @return bool
+             */
+            bool try_take(std::size_t rate, std::size_t burst, std::chrono::steady_clock::time_point now);
+        };
+
+        /**
+         * Buckets
+         */
+        struct buckets {
+            /**
+             * Requests
+             */
+            bucket requests_;
+
+            /**
+             * Fanout
+             */
+            bucket fanout_;
+        };
+
+        /**
+         * Shard
+         */
+        struct shard {
+            /**
+             * Mutex
+             */
+            std::mutex mutex_;
+
+            /**
+             * Entries
+             */
+            std::unordered_map<boost::uuids::uuid, buckets, boost::hash<boost::uuids::uuid> > entries_;
+        };
+
+        /**
+         * Shards Count
+         */
+        static constexpr std::size_t shards_count = 16;
+
+        /**
+         * Config
+         */
+        std::shared_ptr<config> config_;
+
+        /**
+         * Shards
+         */
+        std::array<shard, shards_count> shards_;
+
+        /**
+         * Get Shard
+         *
+         * @param entity_id
+         * @return shard
+         */
+        shard &get_shard(boost::uuids::uuid entity_id);
+
+    public:
+        /**
+         * Constructor
+         *
+         * @param config
+         */
+        explicit rate_limiter(const std::shared_ptr<config> &config);
+
+        /**
+         * Get Enabled
+         *
+         * @return bool
+         */
+        bool get_enabled() const;
+
+        /**
+         * Try Acquire
+         *
+         * Takes a token of the requests bucket and, when fanout is set, of the fanout bucket.
+         *
+         * @param entity_id
+         * @param fanout
+         * @return bool
+         */
+        bool try_acquire(boost::uuids::uuid entity_id, bool fanout);
+
+        /**
+         * Remove
+         *
+         * @param entity_id
+         */
+        void remove(boost::uuids::uuid entity_id);
+
+        /**
+         * Get Size
+         *
+         * @return size_t
+         */
+        std::size_t get_size();
+    };
+} // namespace aewt
+
+#endif  // AEWT_RATE_LIMITER_HPP
@@ -0,0 +1,79 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#ifndef AEWT_RECONCILER_HPP
+#define AEWT_RECONCILER_HPP
+
+#include <memory>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/beast/core.hpp>
+
+namespace aewt {
+    /**
+     * Forward State
+     */
+    class state;
+
+    /**
+     * Reconciler
+     *
+     * Periodically sends the digest of the local state to every session so peers can ask only for the buckets
+     * that drifted.
+     */
+    class reconciler : public std::enable_shared_from_this<reconciler> {
+        /**
+         * State
+         */
+        std::shared_ptr<state> state_;
+
+        /**
+         * Timer
+         */
+        boost::asio::steady_timer timer_;
+
+    public:
+        /**
+         * Constructor
+         *
+         * @param ioc
+         * @param state
+         */
+        reconciler(boost::asio::io_context &ioc, const std::shared_ptr<state> &state);
+
+        /**
+         * Start
+         */
+        void start();
+
+    private:
+        /**
+         * Do Wait
+         */
+        void do_wait();
+
+        /**
+         * On Wait
+         *
+         * @param ec
+         */
+        void on_wait(const boost::beast::error_code &ec);
+    };
+} // namespace aewt
+
+#endif  // AEWT_RECONCILER_HPP
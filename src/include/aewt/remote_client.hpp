@@ -0,0 +1,42 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#ifndef AEWT_REMOTE_CLIENT_HPP
+#define AEWT_REMOTE_CLIENT_HPP
+
+#include <boost/uuid/uuid.hpp>
+
+namespace aewt {
+    /**
+     * Remote Client
+     *
+     * Client connected to another session, only its owner is needed to route messages.
+     */
+    struct remote_client {
+        /**
+         * Client ID
+         */
+        boost::uuids::uuid id_;
+
+        /**
+         * Session ID
+         */
+        boost::uuids::uuid session_id_;
+    };
+} // namespace aewt
+
+#endif  // AEWT_REMOTE_CLIENT_HPP
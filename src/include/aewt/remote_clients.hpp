@@ -0,0 +1,60 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#ifndef AEWT_REMOTE_CLIENTS_HPP
+#define AEWT_REMOTE_CLIENTS_HPP
+
+#include <aewt/remote_client.hpp>
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+
+#include <boost/uuid/uuid.hpp>
+
+namespace aewt {
+    /**
+     * Remote Clients By Session
+     */
+    struct remote_clients_by_session {
+    };
+
+    /**
+     * Remote Clients By Client
+     */
+    struct remote_clients_by_client {
+    };
+
+    /**
+     * Remote Clients
+     */
+    using remote_clients = boost::multi_index::multi_index_container<
+        remote_client,
+        boost::multi_index::indexed_by<
+            boost::multi_index::ordered_non_unique<
+                boost::multi_index::tag<remote_clients_by_session>,
+                boost::multi_index::member<remote_client, boost::uuids::uuid, &remote_client::session_id_>
+            >,
+            boost::multi_index::ordered_unique<
+                boost::multi_index::tag<remote_clients_by_client>,
+                boost::multi_index::member<remote_client, boost::uuids::uuid, &remote_client::id_>
+            >
+        >
+    >;
+} // namespace aewt
+
+#endif  // AEWT_REMOTE_CLIENTS_HPP
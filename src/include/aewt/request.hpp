@@ -30,7 +30,7 @@
 namespace aewt {
     struct request {
         const boost::uuids::uuid transaction_id_;
-        std::shared_ptr<aewt::response> &response_;
+        aewt::response &response_;
         const boost::uuids::uuid entity_id_;
         const kernel_context context_;
         const std::shared_ptr<aewt::state> &state_;
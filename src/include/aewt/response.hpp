@@ -18,7 +18,6 @@
 #ifndef AEWT_RESPONSE_HPP
 #define AEWT_RESPONSE_HPP
 
-#include <atomic>
 #include <boost/json/object.hpp>
 #include <boost/uuid/uuid.hpp>
 #include <map>
@@ -28,21 +27,21 @@ namespace aewt {
     /**
      * Response
      */
-    class response : public std::enable_shared_from_this<response> {
+    class response {
         /**
          * Failed
          */
-        std::atomic<bool> failed_ = false;
+        bool failed_ = false;
 
         /**
          * Processed
          */
-        std::atomic<bool> processed_ = false;
+        bool processed_ = false;
 
         /**
          * Is Ack
          */
-        std::atomic<bool> is_ack_ = false;
+        bool is_ack_ = false;
 
         /**
          * Data
@@ -76,7 +75,7 @@ namespace aewt {
          *
          * @return json::object
          */
-        boost::json::object get_data() const;
+        const boost::json::object &get_data() const;
 
         /**
          * Mark As Failed
@@ -89,6 +88,15 @@ namespace aewt {
         void mark_as_failed(boost::uuids::uuid transaction_id, const char *error, long timestamp,
                             const std::map<std::string, std::string> &bag);
 
+        /**
+         * Set Data
+         *
+         * Replays a stored ack as is.
+         *
+         * @param data
+         */
+        void set_data(const boost::json::object &data);
+
         /**
          * Mark As Processed
          */
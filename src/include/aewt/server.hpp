@@ -42,6 +42,11 @@ namespace aewt {
      */
     class client_listener;
 
+    /**
+     * Forward Reconciler
+     */
+    class reconciler;
+
     class server : public std::enable_shared_from_this<server> {
         /**
          * Config
@@ -63,6 +68,11 @@ namespace aewt {
          */
         std::shared_ptr<client_listener> client_listener_;
 
+        /**
+         * Reconciler
+         */
+        std::shared_ptr<reconciler> reconciler_;
+
         /**
          * Vector Of Threads
          */
@@ -101,6 +111,8 @@ namespace aewt {
 
         /**
          * Stop
+         *
+         * Drains the node when a drain timeout is configured, otherwise stops the io context at once.
          */
         void stop() const;
     };
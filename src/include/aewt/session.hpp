@@ -19,6 +19,7 @@
 #define AEWT_SESSION_HPP
 
 #include <aewt/session_context.hpp>
+#include <aewt/message.hpp>
 
 #include <memory>
 #include <boost/asio/ip/tcp.hpp>
@@ -92,7 +93,7 @@ namespace aewt {
          *
          * @param data
          */
-        void send(std::shared_ptr<std::string const> const &data);
+        void send(message const &data);
 
         /**
          * Run
@@ -152,6 +153,13 @@ namespace aewt {
          * @return
          */
         bool get_registered() const;
+
+        /**
+         * Close
+         *
+         * Sends a going away close frame, messages sent afterwards are dropped.
+         */
+        void close();
     private:
         /**
          * State
@@ -176,7 +184,12 @@ namespace aewt {
         /**
          * Queue
          */
-        std::vector<std::shared_ptr<std::string const> > queue_;
+        std::vector<message> queue_;
+
+        /**
+         * Closing
+         */
+        bool closing_ = false;
 
         /**
          * On Run
@@ -209,7 +222,7 @@ namespace aewt {
          *
          * @param data
          */
-        void on_send(std::shared_ptr<std::string const> const &data);
+        void on_send(message const &data);
 
         /**
          * On Write
@@ -218,6 +231,18 @@ namespace aewt {
          * @param bytes_transferred
          */
         void on_write(const boost::beast::error_code &ec, std::size_t bytes_transferred);
+
+        /**
+         * Do Close
+         */
+        void do_close();
+
+        /**
+         * On Close
+         *
+         * @param ec
+         */
+        void on_close(const boost::beast::error_code &ec);
     };
 } // namespace aewt
 
@@ -76,6 +76,13 @@ namespace aewt {
          * Start
          */
         void start();
+
+        /**
+         * Stop
+         *
+         * Closes the acceptor, established connections are left as they are.
+         */
+        void stop();
     };
 } // namespace aewt
 
@@ -19,15 +19,27 @@
 #define AEWT_STATE_HPP
 
 #include <aewt/config.hpp>
+#include <aewt/channel_trie.hpp>
+#include <aewt/dedup_cache.hpp>
+#include <aewt/history.hpp>
+#include <aewt/loop_monitor.hpp>
+#include <aewt/overload_detector.hpp>
+#include <aewt/rate_limiter.hpp>
 #include <aewt/subscriptions.hpp>
+#include <aewt/interests.hpp>
 #include <aewt/clients.hpp>
+#include <aewt/remote_clients.hpp>
 
 #include <boost/uuid/uuid.hpp>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <optional>
 #include <vector>
 #include <shared_mutex>
+#include <boost/json/array.hpp>
 #include <boost/json/object.hpp>
 
 namespace aewt {
@@ -94,6 +106,13 @@ namespace aewt {
          */
         std::vector<std::shared_ptr<client> > get_clients() const;
 
+        /**
+         * Get Remote Clients
+         *
+         * @return vector<remote_client>
+         */
+        std::vector<remote_client> get_remote_clients() const;
+
         /**
          * Get Subscriptions
          *
@@ -109,6 +128,16 @@ namespace aewt {
          */
         bool get_client_exists(boost::uuids::uuid client_id) const;
 
+        /**
+         * Get Client Session
+         *
+         * Resolves the owner of a local or remote client.
+         *
+         * @param client_id
+         * @return optional<uuid>
+         */
+        std::optional<boost::uuids::uuid> get_client_session(boost::uuids::uuid client_id) const;
+
         /**
          * Get Session
          *
@@ -154,14 +183,48 @@ namespace aewt {
         /**
          * Remove Client
          *
+         * Removes a local client with its subscriptions or the record of a remote one.
+         *
          * @param client_id
          * @return bool
          */
         bool remove_client(boost::uuids::uuid client_id);
 
+        /**
+         * Remove Subscriptions Of Client
+         *
+         * Drops every row of the client in one pass, channels left without subscribers are withdrawn from peers in a
+         * single interest message.
+         *
+         * @param client_id
+         * @return size_t
+         */
+        std::size_t remove_subscriptions_of_client(boost::uuids::uuid client_id);
+
+        /**
+         * Park Client
+         *
+         * @param token
+         * @param client
+         */
+        void park_client(boost::uuids::uuid token, const std::shared_ptr<client> &client);
+
+        /**
+         * Take Parked Client
+         *
+         * Only one caller gets the client, either the reconnect resuming it or the expiration of its window.
+         *
+         * @param token
+         * @return optional<shared_ptr<client>>
+         */
+        std::optional<std::shared_ptr<client> > take_parked_client(boost::uuids::uuid token);
+
         /**
          * Subscribe
          *
+         * Only local clients keep a subscription row, remote ones just count towards the channel of their session.
+         * The first subscriber of a channel on this state advertises the interest to every session.
+         *
          * @param session_id
          * @param client_id
          * @param channel
@@ -173,6 +236,8 @@ namespace aewt {
         /**
          * Unsubscribe
          *
+         * The last subscriber of a channel on this state withdraws the interest from every session.
+         *
          * @param session_id
          * @param client_id
          * @param channel
@@ -181,9 +246,37 @@ namespace aewt {
         bool unsubscribe(const boost::uuids::uuid &session_id, const boost::uuids::uuid &client_id,
                          const std::string &channel);
 
+        /**
+         * Subscribe Many
+         *
+         * Applies every channel under a single acquisition of the subscriptions lock, channels gaining their first
+         * subscriber are advertised to peers in one interest message.
+         *
+         * @param session_id
+         * @param client_id
+         * @param channels
+         * @return vector<bool> Whether each channel took effect
+         */
+        std::vector<bool> subscribe_many(const boost::uuids::uuid &session_id, const boost::uuids::uuid &client_id,
+                                         const std::vector<std::string> &channels);
+
+        /**
+         * Unsubscribe Many
+         *
+         * @param session_id
+         * @param client_id
+         * @param channels
+         * @return vector<bool> Whether each channel took effect
+         */
+        std::vector<bool> unsubscribe_many(const boost::uuids::uuid &session_id, const boost::uuids::uuid &client_id,
+                                           const std::vector<std::string> &channels);
+
         /**
          * Is Subscribed
          *
+         * Exact for local clients, for remote clients it tells whether their session has subscribers on the channel.
+         * Pattern subscriptions count when they match the channel.
+         *
          * @param client_id
          * @param channel
          * @return bool
@@ -243,6 +336,8 @@ namespace aewt {
         /**
          * Publish To Clients
          *
+         * With the history enabled the publication carries its sequence and is kept for subscribers catching up.
+         *
          * @param request
          * @param session_id
          * @param client_id
@@ -275,16 +370,15 @@ namespace aewt {
         std::size_t leave_to_sessions(boost::uuids::uuid client_id) const;
 
         /**
-         * Subscribe To Sessions
+         * Interest To Sessions
          *
-         * @param request
-         * @param client_id
-         * @param channel
+         * @param add
+         * @param remove
          *
          * @return size_t
          */
-        std::size_t subscribe_to_sessions(const request &request,
-                                          boost::uuids::uuid client_id, const std::string &channel) const;
+        std::size_t interest_to_sessions(const std::vector<std::string> &add,
+                                         const std::vector<std::string> &remove) const;
 
         /**
          *  Push Client
@@ -294,6 +388,47 @@ namespace aewt {
          */
         bool push_client(const std::shared_ptr<client> &client);
 
+        /**
+         * Push Remote Client
+         *
+         * @param client
+         * @return bool
+         */
+        bool push_remote_client(const remote_client &client);
+
+        /**
+         * Push Remote Clients
+         *
+         * @param clients
+         * @return size_t
+         */
+        std::size_t push_remote_clients(const std::vector<remote_client> &clients);
+
+        /**
+         * Get Interests
+         *
+         * @return vector<interest>
+         */
+        std::vector<interest> get_interests() const;
+
+        /**
+         * Push Interests
+         *
+         * @param session_id
+         * @param channels
+         * @return size_t
+         */
+        std::size_t push_interests(const boost::uuids::uuid &session_id, const std::vector<std::string> &channels);
+
+        /**
+         * Pull Interests
+         *
+         * @param session_id
+         * @param channels
+         * @return size_t
+         */
+        std::size_t pull_interests(const boost::uuids::uuid &session_id, const std::vector<std::string> &channels);
+
         /**
          * Sync
          *
@@ -303,22 +438,75 @@ namespace aewt {
         void sync(const std::shared_ptr<session> &session, bool registered);
 
         /**
-         * Get IO Context
+         * Get Digest
          *
-         * @return
+         * Hashes the clients and channel interests owned by the session into buckets, XOR combined so the result does
+         * not depend on iteration order.
+         *
+         * @param session_id
+         * @return vector<uint64_t>
          */
-        boost::asio::io_context &get_ioc();
+        std::vector<std::uint64_t> get_digest(boost::uuids::uuid session_id) const;
 
         /**
-         * Unsubscribe To Sessions
+         * Digest To Sessions
+         *
+         * @return size_t
+         */
+        std::size_t digest_to_sessions() const;
+
+        /**
+         * Drain To Sessions
+         *
+         * Tells every session that this state is leaving, from then on the state stops advertising its clients
+         * and interests.
          *
-         * @param request
-         * @param client_id
-         * @param channel
          * @return size_t
          */
-        std::size_t unsubscribe_to_sessions(const request &request,
-                                            boost::uuids::uuid client_id, const std::string &channel) const;
+        std::size_t drain_to_sessions();
+
+        /**
+         * Get Draining
+         *
+         * @return bool
+         */
+        bool get_draining() const;
+
+        /**
+         * Clear Parked Clients
+         *
+         * Removes the clients waiting for a resumption, returns how many were removed.
+         *
+         * @return size_t
+         */
+        std::size_t clear_parked_clients();
+
+        /**
+         * Reconcile
+         *
+         * Replays the local clients and interests of the given buckets asking the session to reset them first.
+         *
+         * @param session
+         * @param buckets
+         * @return size_t
+         */
+        std::size_t reconcile(const std::shared_ptr<session> &session, const std::vector<std::size_t> &buckets) const;
+
+        /**
+         * Remove State Of Buckets
+         *
+         * @param id
+         * @param buckets
+         * @return size_t
+         */
+        std::size_t remove_state_of_buckets(boost::uuids::uuid id, const std::vector<std::size_t> &buckets);
+
+        /**
+         * Get IO Context
+         *
+         * @return
+         */
+        boost::asio::io_context &get_ioc();
 
         /**
          * Remove State Of Session
@@ -345,6 +533,41 @@ namespace aewt {
          */
         std::shared_ptr<config> get_config();
 
+        /**
+         * Get Dedup Cache
+         *
+         * @return dedup_cache
+         */
+        dedup_cache &get_dedup_cache();
+
+        /**
+         * Get History
+         *
+         * @return history
+         */
+        history &get_history();
+
+        /**
+         * Get Rate Limiter
+         *
+         * @return rate_limiter
+         */
+        rate_limiter &get_rate_limiter();
+
+        /**
+         * Get Overload Detector
+         *
+         * @return overload_detector
+         */
+        overload_detector &get_overload_detector();
+
+        /**
+         * Get Loop Monitor
+         *
+         * @return loop_monitor
+         */
+        loop_monitor &get_loop_monitor();
+
     private:
         /**
          * Send To Sessions
@@ -354,6 +577,46 @@ namespace aewt {
          */
         std::size_t send_to_sessions(const boost::json::object &data) const;
 
+        /**
+         * Send Sync
+         *
+         * @param session
+         * @param clients
+         * @param channels
+         * @param reset
+         * @return size_t
+         */
+        std::size_t send_sync(const std::shared_ptr<session> &session, const std::vector<boost::uuids::uuid> &clients,
+                              const std::vector<std::string> &channels,
+                              const boost::json::array &reset = {}) const;
+
+        /**
+         * Increment Interest
+         *
+         * @param session_id
+         * @param channel
+         * @return size_t Subscribers after the increment
+         */
+        std::size_t increment_interest(const boost::uuids::uuid &session_id, const std::string &channel);
+
+        /**
+         * Decrement Interest
+         *
+         * @param session_id
+         * @param channel
+         * @return optional<size_t> Subscribers after the decrement, empty when the channel was unknown
+         */
+        std::optional<std::size_t> decrement_interest(const boost::uuids::uuid &session_id,
+                                                      const std::string &channel);
+
+        /**
+         * Get Interest Channels
+         *
+         * @param session_id
+         * @return vector<string>
+         */
+        std::vector<std::string> get_interest_channels(const boost::uuids::uuid &session_id) const;
+
         /**
          * Send To Clients
          *
@@ -362,7 +625,7 @@ namespace aewt {
          * @param client_id Cliente que solicitó transmitir
          * @return
          */
-        std::size_t send_to_others_clients(const std::shared_ptr<boost::json::object> &data,
+        std::size_t send_to_others_clients(const message &data,
                                            boost::uuids::uuid session_id,
                                            boost::uuids::uuid client_id) const;
 
@@ -388,14 +651,35 @@ namespace aewt {
 
         /**
          * Clients
+         *
+         * Only clients with a socket on this state.
          */
         clients clients_;
 
+        /**
+         * Remote Clients
+         *
+         * Guarded by the clients mutex.
+         */
+        remote_clients remote_clients_;
+
+        /**
+         * Parked Clients
+         *
+         * Local clients without socket by resume token, guarded by the clients mutex.
+         */
+        std::map<boost::uuids::uuid, std::shared_ptr<client> > parked_clients_;
+
         /**
          * Clients Shared Mutex
          */
         mutable std::shared_mutex clients_mutex_;
 
+        /**
+         * Draining
+         */
+        std::atomic<bool> draining_ = false;
+
         /**
          * Subscriptions
          */
@@ -405,6 +689,50 @@ namespace aewt {
          * Sessions Shared Mutex
          */
         mutable std::shared_mutex subscriptions_mutex_;
+
+        /**
+         * Interests
+         *
+         * Subscribers per session and channel, the rows of this state are the ones advertised to peers.
+         */
+        interests interests_;
+
+        /**
+         * Patterns
+         *
+         * Interests whose channel has wildcard segments, guarded by the interests mutex.
+         */
+        channel_trie patterns_;
+
+        /**
+         * Interests Shared Mutex
+         */
+        mutable std::shared_mutex interests_mutex_;
+
+        /**
+         * Dedup Cache
+         */
+        dedup_cache dedup_cache_;
+
+        /**
+         * History
+         */
+        history history_;
+
+        /**
+         * Rate Limiter
+         */
+        rate_limiter rate_limiter_;
+
+        /**
+         * Overload Detector
+         */
+        overload_detector overload_detector_;
+
+        /**
+         * Loop Monitor
+         */
+        loop_monitor loop_monitor_;
     };
 } // namespace aewt
 
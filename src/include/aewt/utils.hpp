@@ -3,9 +3,14 @@
 #ifndef AEWT_UTILS_HPP
 #define AEWT_UTILS_HPP
 
+#include <boost/json/array.hpp>
 #include <boost/json/object.hpp>
 #include <boost/uuid/uuid.hpp>
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <aewt/kernel_context.hpp>
 
@@ -96,6 +101,14 @@ namespace aewt {
      */
     boost::uuids::uuid get_param_as_id(const boost::json::object &params, const char *field);
 
+    /**
+     * Get Value As ID
+     *
+     * @param value
+     * @return uuid
+     */
+    boost::uuids::uuid get_value_as_id(const boost::json::value &value);
+
     /**
      * Get Params As Number
      *
@@ -157,28 +170,106 @@ namespace aewt {
                                                     const boost::json::object &payload);
 
     /**
-     * Make Subscribe Request Object
+     * Make Interest Request Object
+     *
+     * @param add
+     * @param remove
+     * @return object
+     */
+    boost::json::object make_interest_request_object(const boost::json::array &add,
+                                                     const boost::json::array &remove);
+
+    /**
+     * Make Sync Request Object
+     *
+     * @param clients
+     * @param interests
+     * @param reset
+     * @return object
+     */
+    boost::json::object make_sync_request_object(const boost::json::array &clients,
+                                                 const boost::json::array &interests,
+                                                 const boost::json::array &reset = {});
+
+    /**
+     * Make Digest Request Object
+     *
+     * @param digest
+     * @return object
+     */
+    boost::json::object make_digest_request_object(const std::vector<std::uint64_t> &digest);
+
+    /**
+     * Make Reconcile Request Object
+     *
+     * @param buckets
+     * @return object
+     */
+    boost::json::object make_reconcile_request_object(const boost::json::array &buckets);
+
+    /**
+     * Make Draining Request Object
+     *
+     * @return object
+     */
+    boost::json::object make_draining_request_object();
+
+    /**
+     * Digest Buckets
+     */
+    constexpr std::size_t digest_buckets = 16;
+
+    /**
+     * Get Digest Bucket
+     *
+     * Clients fall in the bucket picked by the first nibble of their id.
      *
-     * @param request
      * @param client_id
+     * @return size_t
+     */
+    std::size_t get_digest_bucket(const boost::uuids::uuid &client_id);
+
+    /**
+     * Get Digest Bucket
+     *
+     * Channels fall in the bucket picked by the first nibble of their hash.
+     *
      * @param channel
-     * @return object
+     * @return size_t
      */
-    boost::json::object make_subscribe_request_object(const request &request,
-                                                      const boost::uuids::uuid &client_id,
-                                                      const std::string &channel);
+    std::size_t get_digest_bucket(std::string_view channel);
 
     /**
-     * Make Unsubscribe Request Object
+     * Get Digest Hash
      *
-     * @param request
      * @param client_id
+     * @return uint64_t
+     */
+    std::uint64_t get_digest_hash(const boost::uuids::uuid &client_id);
+
+    /**
+     * Get Digest Hash
+     *
      * @param channel
-     * @return object
+     * @return uint64_t
+     */
+    std::uint64_t get_digest_hash(std::string_view channel);
+
+    /**
+     * Get Values As Buckets
+     *
+     * @param values
+     * @return vector<size_t>
      */
-    boost::json::object make_unsubscribe_request_object(const request &request,
-                                                        const boost::uuids::uuid &client_id,
-                                                        const std::string &channel);
+    std::vector<std::size_t> get_values_as_buckets(const boost::json::array &values);
+
+    /**
+     * Get Values As Strings
+     *
+     * @param values
+     * @return vector<string>
+     */
+    std::vector<std::string> get_values_as_strings(const boost::json::array &values);
 
     /**
      * Get Status
@@ -197,6 +288,15 @@ namespace aewt {
      * @return string
      */
     std::string kernel_context_to_string(kernel_context context);
+
+    /**
+     * Get Query Param
+     *
+     * @param target Request target of the upgrade
+     * @param name
+     * @return optional<string_view>
+     */
+    std::optional<std::string_view> get_query_param(std::string_view target, std::string_view name);
 }
 
 #endif // AEWT_UTILS_HPP
@@ -65,6 +65,14 @@ namespace aewt {
          * @return
          */
         static bool is_uuid(const char *uuid);
+
+        /**
+         * Is Bucket
+         *
+         * @param value
+         * @return
+         */
+        static bool is_bucket(const boost::json::value &value);
     };
 } // namespace aewt
 
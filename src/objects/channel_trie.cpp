@@ -0,0 +1,175 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/channel_trie.hpp>
+
+namespace aewt {
+    static std::vector<std::string_view> split_channel(const std::string_view channel) {
+        std::vector<std::string_view> _segments;
+
+        std::size_t _begin = 0;
+        while (true) {
+            const auto _end = channel.find('.', _begin);
+            if (_end == std::string_view::npos) {
+                _segments.push_back(channel.substr(_begin));
+                return _segments;
+            }
+
+            _segments.push_back(channel.substr(_begin, _end - _begin));
+            _begin = _end + 1;
+        }
+    }
+
+    static bool matches_segments(const std::vector<std::string_view> &pattern, const std::size_t pattern_position,
+                                 const std::vector<std::string_view> &topic, const std::size_t topic_position) {
+        if (pattern_position == pattern.size())
+            return topic_position == topic.size();
+
+        const auto _segment = pattern[pattern_position];
+
+        // "#" consume de cero a todos los segmentos restantes
+        if (_segment == "#") {
+            for (auto _position = topic_position; _position <= topic.size(); ++_position) {
+                if (matches_segments(pattern, pattern_position + 1, topic, _position))
+                    return true;
+            }
+            return false;
+        }
+
+        if (topic_position == topic.size())
+            return false;
+
+        if (_segment != "*" && _segment != topic[topic_position])
+            return false;
+
+        return matches_segments(pattern, pattern_position + 1, topic, topic_position + 1);
+    }
+
+    std::size_t channel_trie::segment_hash::operator()(const std::string_view value) const {
+        return boost::hash_range(value.begin(), value.end());
+    }
+
+    bool channel_trie::node::is_empty() const {
+        return sessions_.empty() && children_.empty() && !single_ && !multi_;
+    }
+
+    bool channel_trie::is_pattern(const std::string_view channel) {
+        for (const auto _segment: split_channel(channel)) {
+            if (_segment == "*" || _segment == "#")
+                return true;
+        }
+
+        return false;
+    }
+
+    bool channel_trie::matches(const std::string_view pattern, const std::string_view topic) {
+        return matches_segments(split_channel(pattern), 0, split_channel(topic), 0);
+    }
+
+    bool channel_trie::insert(const std::string_view pattern, const boost::uuids::uuid &session_id) {
+        auto *_current = &root_;
+
+        for (const auto _segment: split_channel(pattern)) {
+            auto &_next = _segment == "*"
+                              ? _current->single_
+                              : _segment == "#"
+                                    ? _current->multi_
+                                    : _current->children_[std::string(_segment)];
+
+            if (!_next)
+                _next = std::make_unique<node>();
+
+            _current = _next.get();
+        }
+
+        const auto _inserted = _current->sessions_.insert(session_id).second;
+        if (_inserted)
+            ++size_;
+
+        return _inserted;
+    }
+
+    bool channel_trie::erase(const std::string_view pattern, const boost::uuids::uuid &session_id) {
+        const auto _erased = erase(root_, split_channel(pattern), 0, session_id);
+        if (_erased)
+            --size_;
+
+        return _erased;
+    }
+
+    bool channel_trie::erase(node &current, const std::vector<std::string_view> &segments,
+                             const std::size_t position, const boost::uuids::uuid &session_id) {
+        if (position == segments.size())
+            return current.sessions_.erase(session_id) > 0;
+
+        const auto _segment = segments[position];
+
+        std::unique_ptr<node> *_next = nullptr;
+        auto _child = current.children_.end();
+
+        if (_segment == "*") {
+            _next = &current.single_;
+        } else if (_segment == "#") {
+            _next = &current.multi_;
+        } else {
+            _child = current.children_.find(_segment);
+            if (_child != current.children_.end())
+                _next = &_child->second;
+        }
+
+        if (_next == nullptr || !*_next || !erase(**_next, segments, position + 1, session_id))
+            return false;
+
+        // Se podan las ramas vacías para que los patrones retirados no sigan costando en cada coincidencia
+        if ((*_next)->is_empty()) {
+            if (_child != current.children_.end())
+                current.children_.erase(_child);
+            else
+                _next->reset();
+        }
+
+        return true;
+    }
+
+    void channel_trie::match(const std::string_view topic, std::vector<boost::uuids::uuid> &output) const {
+        if (size_ == 0)
+            return;
+
+        match(root_, split_channel(topic), 0, output);
+    }
+
+    void channel_trie::match(const node &current, const std::vector<std::string_view> &segments,
+                             const std::size_t position, std::vector<boost::uuids::uuid> &output) {
+        if (current.multi_) {
+            for (auto _position = position; _position <= segments.size(); ++_position)
+                match(*current.multi_, segments, _position, output);
+        }
+
+        if (position == segments.size()) {
+            output.insert(output.end(), current.sessions_.begin(), current.sessions_.end());
+            return;
+        }
+
+        if (const auto _child = current.children_.find(segments[position]); _child != current.children_.end())
+            match(*_child->second, segments, position + 1, output);
+
+        if (current.single_)
+            match(*current.single_, segments, position + 1, output);
+    }
+
+    std::size_t channel_trie::get_size() const {
+        return size_;
+    }
+} // namespace aewt
@@ -16,30 +16,64 @@
 #include <aewt/client.hpp>
 
 #include <aewt/logger.hpp>
+#include <aewt/message.hpp>
 #include <aewt/state.hpp>
 #include <aewt/kernel.hpp>
 #include <aewt/response.hpp>
+#include <aewt/deflate.hpp>
+#include <aewt/utils.hpp>
 
 #include <boost/core/ignore_unused.hpp>
 
 #include <boost/uuid/uuid_io.hpp>
 #include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/string_generator.hpp>
 #include <boost/json/parse.hpp>
 #include <boost/json/serialize.hpp>
 
+#include <sstream>
+#include <utility>
+
 namespace aewt {
+    /**
+     * Queue Reserve
+     *
+     * Queue capacity kept by a client once its pending writes drain.
+     */
+    static constexpr std::size_t queue_reserve = 8;
+
+    /**
+     * Get Resume Token
+     *
+     * @param target
+     * @return optional<uuid>
+     */
+    static std::optional<boost::uuids::uuid> get_resume_token(const std::string_view target) {
+        const auto _value = get_query_param(target, "resume_token");
+        if (!_value.has_value())
+            return std::nullopt;
+
+        try {
+            return boost::uuids::string_generator()(std::string{_value.value()});
+        } catch (const std::runtime_error &) {
+            return std::nullopt;
+        }
+    }
+
     client::client(const boost::uuids::uuid session_id,
                    const std::shared_ptr<state> &state, const boost::uuids::uuid id) : state_(state),
         id_(id),
         session_id_(session_id),
         is_local_(state->get_id() == session_id) {
-        LOG_INFO("state_id=[{}] action=[client_allocated] session_id=[{}] client_id=[{}]", to_string(state_->get_id()),
-                 to_string(session_id), to_string(id_));
+        LOG_INFO("state_id=[{}] action=[client_allocated] session_id=[{}] client_id=[{}]", state_->get_id(),
+                 session_id, id_);
     }
 
     client::~client() {
-        LOG_INFO("state_id=[{}] action=[client_released] session_id=[{}] client_id=[{}]", to_string(state_->get_id()),
-                 to_string(get_session_id()), to_string(id_));
+        state_->get_overload_detector().on_dequeued(queue_.size());
+
+        LOG_INFO("state_id=[{}] action=[client_released] session_id=[{}] client_id=[{}]", state_->get_id(),
+                 get_session_id(), id_);
     }
 
     boost::uuids::uuid client::get_id() const { return id_; }
@@ -52,30 +86,165 @@ namespace aewt {
         return is_local_;
     }
 
+    bool client::get_no_ack() const {
+        return no_ack_;
+    }
+
     void client::run() {
         auto _run_at = std::chrono::system_clock::now().time_since_epoch().count();
         if (socket_.has_value()) {
             auto &_socket = socket_.value();
-            _socket.async_accept(boost::beast::bind_front_handler(&client::on_accept, shared_from_this(), _run_at));
+            const auto &_config = state_->get_config();
+            _socket.set_option(get_deflate_options(*_config, _config->deflate_clients_));
+
+            // Se lee el upgrade antes de aceptar para conocer la oferta de compresión del cliente
+            boost::beast::http::async_read(_socket.next_layer(), buffer_, upgrade_,
+                                           boost::beast::bind_front_handler(
+                                               &client::on_upgrade, shared_from_this(), _run_at));
         }
     }
 
-    void client::send(std::shared_ptr<std::string const> const &data) {
-        boost::ignore_unused(data);
-
-        if (socket_.has_value()) {
-            if (auto &_socket = socket_.value(); _socket.is_open()) {
-                post(_socket.get_executor(),
-                     boost::beast::bind_front_handler(&client::on_send, shared_from_this(), data));
+    void client::send(message const &data) {
+        // El mutex solo se toma con el cliente estacionado, el fan-out normal no lo paga
+        if (parked_.load(std::memory_order_acquire)) {
+            std::lock_guard _lock(resume_mutex_);
+            if (parked_.load(std::memory_order_relaxed)) {
+                push_parked(data);
+                return;
             }
         }
+
+        // Los clientes de otros nodos no tienen socket
+        if (!executor_)
+            return;
+
+        post(executor_, boost::beast::bind_front_handler(&client::on_send, shared_from_this(), data));
+    }
+
+    void client::close() {
+        if (!executor_)
+            return;
+
+        post(executor_, boost::beast::bind_front_handler(&client::do_close, shared_from_this()));
     }
 
     void client::set_socket(boost::asio::ip::tcp::socket &&socket) {
+        executor_ = socket.get_executor();
         socket_.emplace(std::move(socket));
     }
 
+    void client::resume(boost::asio::ip::tcp::socket &&socket,
+                        boost::beast::http::request<boost::beast::http::string_body> &&upgrade,
+                        boost::beast::flat_buffer &&buffer, const long run_at) {
+        // El timer y las escrituras de la conexión anterior corren en este executor, el cambio también
+        post(executor_,
+             [_self = shared_from_this(), _socket = std::move(socket), _upgrade = std::move(upgrade),
+                 _buffer = std::move(buffer), run_at]() mutable {
+                 _self->do_resume(_socket, _upgrade, _buffer, run_at);
+             });
+    }
+
+    void client::do_resume(boost::asio::ip::tcp::socket &socket,
+                           boost::beast::http::request<boost::beast::http::string_body> &upgrade,
+                           boost::beast::flat_buffer &buffer, const long run_at) {
+        if (expiry_ != nullptr) {
+            expiry_->cancel();
+            expiry_.reset();
+        }
+
+        // El socket nuevo se reconstruye sobre el executor de este cliente para seguir serializado con lo pendiente
+        boost::system::error_code _ec;
+        boost::asio::ip::tcp::socket _socket(socket_.value().get_executor());
+        const auto _protocol = socket.local_endpoint(_ec).protocol();
+        if (!_ec)
+            _socket.assign(_protocol, socket.release(_ec), _ec);
+
+        if (_ec) {
+            LOG_INFO("state_id=[{}] action=[client_resume_failed] client_id=[{}] status=[{}]", state_->get_id(), id_,
+                     _ec.message());
+
+            {
+                std::lock_guard _lock(resume_mutex_);
+                parked_queue_.clear();
+            }
+
+            state_->remove_client(id_);
+            const auto _ = state_->leave_to_sessions(get_id());
+            boost::ignore_unused(_);
+            return;
+        }
+
+        {
+            std::lock_guard _lock(resume_mutex_);
+            socket_.emplace(std::move(_socket));
+        }
+
+        const auto &_config = state_->get_config();
+        socket_.value().set_option(get_deflate_options(*_config, _config->deflate_clients_));
+
+        // Lo que el cliente envió junto al upgrade sigue al request, no se descarta
+        buffer_ = std::move(buffer);
+        upgrade_ = std::move(upgrade);
+        closing_ = false;
+        resumed_ = true;
+
+        LOG_INFO("state_id=[{}] action=[client_resumed] client_id=[{}]", state_->get_id(), id_);
+
+        do_accept(run_at);
+    }
+
+    void client::on_upgrade(long run_at, const boost::beast::error_code &ec, std::size_t bytes_transferred) {
+        boost::ignore_unused(bytes_transferred);
+
+        // Aún no fue registrado ni anunciado, no hay nada que retirar
+        if (ec)
+            return;
+
+        if (state_->get_config()->resume_window_ > 0) {
+            const auto _target = upgrade_.target();
+
+            if (const auto _token = get_resume_token(std::string_view{_target.data(), _target.size()});
+                _token.has_value()) {
+                // Un cliente retomado no genera tráfico hacia los pares, conserva su id y suscripciones
+                if (const auto _parked = state_->take_parked_client(_token.value()); _parked.has_value()) {
+                    _parked.value()->resume(socket_.value().next_layer().release_socket(), std::move(upgrade_),
+                                            std::move(buffer_), run_at);
+                    return;
+                }
+            }
+        }
+
+        state_->add_client(shared_from_this());
+        const auto _ = state_->join_to_sessions(get_id());
+        boost::ignore_unused(_);
+
+        do_accept(run_at);
+    }
+
+    void client::do_accept(const long run_at) {
+        const auto _target = upgrade_.target();
+        const auto _no_ack = get_query_param(std::string_view{_target.data(), _target.size()}, "no_ack");
+        no_ack_ = _no_ack.has_value() && _no_ack.value() != "0" && _no_ack.value() != "false";
+
+        if (buffer_.size() == 0) {
+            socket_.value().async_accept(upgrade_, boost::beast::bind_front_handler(
+                                             &client::on_accept, shared_from_this(), run_at));
+            return;
+        }
+
+        // Los bytes leídos tras el upgrade ya son frames, Beast los toma junto al request y los copia antes de volver
+        std::ostringstream _handshake;
+        _handshake << upgrade_ << boost::beast::buffers_to_string(buffer_.data());
+        buffer_.consume(buffer_.size());
+
+        const auto _data = _handshake.str();
+        socket_.value().async_accept(boost::asio::buffer(_data), boost::beast::bind_front_handler(
+                                         &client::on_accept, shared_from_this(), run_at));
+    }
+
     void client::on_accept(long run_at, const boost::beast::error_code &ec) {
+        upgrade_ = {};
+
         if (ec) {
             state_->remove_client(id_);
             const auto _ = state_->leave_to_sessions(get_id());
@@ -83,6 +252,30 @@ namespace aewt {
             return;
         }
 
+        boost::json::object _data = {{"client_id", to_string(get_id())}};
+
+        if (state_->get_config()->resume_window_ > 0) {
+            resume_token_ = boost::uuids::random_generator()();
+            _data["resume_token"] = to_string(resume_token_);
+        }
+
+        std::deque<message> _parked;
+        std::size_t _dropped = 0; {
+            std::lock_guard _lock(resume_mutex_);
+            parked_.store(false, std::memory_order_release);
+            _parked.swap(parked_queue_);
+            _dropped = std::exchange(dropped_, 0);
+        }
+
+        if (no_ack_)
+            _data["no_ack"] = true;
+
+        if (resumed_) {
+            _data["resumed"] = true;
+            _data["dropped"] = _dropped;
+            resumed_ = false;
+        }
+
         auto _now = std::chrono::system_clock::now().time_since_epoch().count();
         const boost::json::object _welcome = {
             {"transaction_id", to_string(boost::uuids::random_generator()())},
@@ -91,9 +284,14 @@ namespace aewt {
             {"message", "accepted"},
             {"timestamp", _now},
             {"runtime", _now - run_at},
-            {"data", {{"client_id", to_string(get_id())}}},
+            {"data", _data},
         };
-        send(std::make_shared<std::string const>(serialize(_welcome)));
+
+        // Ya en el executor del socket, la bienvenida sale antes que lo recibido mientras estuvo estacionado
+        on_send(make_message(_welcome));
+
+        for (const auto &_message: _parked)
+            on_send(_message);
 
         do_read();
     }
@@ -114,6 +312,11 @@ namespace aewt {
         }
 
         if (ec) {
+            if (state_->get_config()->resume_window_ > 0) {
+                do_park();
+                return;
+            }
+
             state_->remove_client(id_);
             const auto _ = state_->leave_to_sessions(get_id());
             boost::ignore_unused(_);
@@ -126,8 +329,19 @@ namespace aewt {
         boost::system::error_code _parse_ec;
 
         if (auto _data = boost::json::parse(_stream, _parse_ec); !_parse_ec && _data.is_object()) {
-            const auto _response = kernel(state_, _data.as_object(), on_client, get_id());
-            send(std::make_shared<std::string const>(serialize(_response->get_data())));
+            const auto &_object = _data.as_object();
+
+            // La solicitud puede pedir o suprimir su ack, si no lo indica rige lo negociado en la conexión
+            auto _no_ack = no_ack_;
+            if (const auto _field = _object.if_contains("no_ack"); _field != nullptr && _field->is_bool())
+                _no_ack = _field->as_bool();
+
+            response _response;
+            kernel(state_, _object, on_client, get_id(), _response);
+
+            // Los errores siempre se informan
+            if (_response.get_failed() || !_no_ack)
+                send(make_message(_response.get_data()));
         } else {
             auto _now = std::chrono::system_clock::now().time_since_epoch().count();
             const boost::json::object _response = {
@@ -142,47 +356,156 @@ namespace aewt {
                 {"timestamp", _now},
                 {"runtime", _now - _read_at},
             };
-            send(std::make_shared<std::string const>(serialize(_response)));
+            send(make_message(_response));
         }
 
         buffer_.consume(buffer_.size());
 
+        // Un mensaje grande no debe dejar su reserva en un cliente que luego queda ocioso
+        if (buffer_.capacity() > state_->get_config()->client_buffer_limit_)
+            buffer_.shrink_to_fit();
+
         do_read();
     }
 
-    void client::on_send(std::shared_ptr<std::string const> const &data) {
+    void client::on_send(message const &data) {
+        // Lo publicado justo antes de estacionar llega después, se guarda junto a lo demás
+        if (parked_.load(std::memory_order_acquire)) {
+            std::lock_guard _lock(resume_mutex_);
+            if (parked_.load(std::memory_order_relaxed)) {
+                push_parked(data);
+                return;
+            }
+        }
+
+        // El frame de cierre ya salió, una escritura posterior se cruzaría con él
+        if (closing_ || !socket_.value().is_open())
+            return;
+
         queue_.push_back(data);
+        state_->get_overload_detector().on_enqueued();
 
-        if (queue_.size() > 1)
+        if (writing_)
             return;
 
-        const auto _message = *queue_.begin();
+        do_write();
+    }
 
-        if (socket_.has_value()) {
-            if (auto &_socket = socket_.value(); _socket.is_open()) {
-                _socket.async_write(boost::asio::buffer(*queue_.front()),
-                                    boost::beast::bind_front_handler(&client::on_write, shared_from_this()));
-            }
+    void client::do_write() {
+        if (!socket_.has_value())
+            return;
+
+        auto &_socket = socket_.value();
+        if (!_socket.is_open())
+            return;
+
+        const auto _generation = generation_.load(std::memory_order_acquire);
+
+        // Todo pasa por Beast, así sus pongs y cierres nunca se intercalan con un mensaje a medio escribir
+        writing_ = true;
+        _socket.async_write(queue_.front().get_buffer(),
+                            boost::beast::bind_front_handler(&client::on_write, shared_from_this(), _generation));
+    }
+
+    void client::on_write(const std::size_t generation, const boost::beast::error_code &ec,
+                          std::size_t bytes_transferred) {
+        boost::ignore_unused(bytes_transferred);
+
+        // El mensaje escrito sigue al frente aunque la conexión haya cambiado, recién aquí se libera
+        writing_ = false;
+        queue_.erase(queue_.begin());
+        state_->get_overload_detector().on_dequeued();
+
+        // Con la conexión actual caída la lectura estaciona al cliente, lo de una anterior deja pasar al resto
+        if (ec && generation == generation_.load(std::memory_order_acquire))
+            return;
+
+        if (!queue_.empty()) {
+            do_write();
+            return;
         }
+
+        // La cola vacía libera la reserva que dejó una ráfaga de mensajes
+        if (queue_.capacity() > queue_reserve)
+            std::vector<message>().swap(queue_);
     }
 
-    void client::on_write(const boost::beast::error_code &ec, std::size_t bytes_transferred) {
-        if (ec)
+    void client::do_close() {
+        if (closing_ || !socket_.has_value() || !socket_.value().is_open())
             return;
 
-        queue_.erase(queue_.begin());
+        closing_ = true;
+        socket_.value().async_close(boost::beast::websocket::close_code::going_away,
+                                    boost::beast::bind_front_handler(&client::on_close, shared_from_this()));
+    }
 
-        if (!queue_.empty() && socket_.has_value()) {
-            if (auto &_socket = socket_.value(); _socket.is_open()) {
-                _socket.async_write(
-                    boost::asio::buffer(*queue_.front()),
-                    boost::beast::bind_front_handler(
-                        &client::on_write,
-                        shared_from_this()));
-            }
+    void client::on_close(const boost::beast::error_code &ec) {
+        LOG_INFO("state_id=[{}] action=[client_closed] client_id=[{}] status=[{}]", state_->get_id(), id_,
+                 ec ? ec.message() : "ok");
+    }
+
+    void client::do_park() {
+        const auto &_config = state_->get_config();
+
+        {
+            std::lock_guard _lock(resume_mutex_);
+            parked_.store(true, std::memory_order_release);
+            generation_.fetch_add(1, std::memory_order_acq_rel);
+
+            // Lo pendiente se reenvía al retomar, el primero pudo haber llegado y se acepta el duplicado
+            for (const auto &_message: queue_)
+                push_parked(_message);
+        }
+
+        // La escritura en curso aún lee el frente, se conserva hasta su on_write y el socket se cierra para que termine
+        const auto _kept = writing_ ? std::size_t{1} : std::size_t{0};
+        state_->get_overload_detector().on_dequeued(queue_.size() - _kept);
+        queue_.erase(queue_.begin() + static_cast<std::ptrdiff_t>(_kept), queue_.end());
+
+        boost::beast::error_code _ec;
+        boost::beast::get_lowest_layer(socket_.value()).socket().close(_ec);
+
+        state_->park_client(resume_token_, shared_from_this());
+
+        expiry_ = std::make_shared<boost::asio::steady_timer>(
+            socket_.value().get_executor(), std::chrono::seconds(_config->resume_window_));
+        expiry_->async_wait(boost::beast::bind_front_handler(&client::on_expire, shared_from_this(), expiry_,
+                                                             resume_token_));
+
+        LOG_INFO("state_id=[{}] action=[client_parked] client_id=[{}]", state_->get_id(), id_);
+    }
+
+    void client::push_parked(message const &data) {
+        parked_queue_.push_back(data);
+
+        if (parked_queue_.size() > state_->get_config()->resume_buffer_) {
+            parked_queue_.pop_front();
+            ++dropped_;
         }
     }
 
+    void client::on_expire(const std::shared_ptr<boost::asio::steady_timer> &timer, const boost::uuids::uuid token,
+                           const boost::system::error_code &ec) {
+        boost::ignore_unused(timer);
+
+        if (ec)
+            return;
+
+        expiry_.reset();
+
+        // Si el token ya no está, el cliente fue retomado antes de vencer
+        if (!state_->take_parked_client(token).has_value())
+            return;
+
+        {
+            std::lock_guard _lock(resume_mutex_);
+            parked_queue_.clear();
+        }
+
+        state_->remove_client(id_);
+        const auto _ = state_->leave_to_sessions(get_id());
+        boost::ignore_unused(_);
+    }
 
     std::optional<boost::beast::websocket::stream<boost::beast::tcp_stream> > &client::get_socket() { return socket_; }
 } // namespace aewt
@@ -18,6 +18,7 @@
 #include <boost/asio/strand.hpp>
 
 #include <aewt/logger.hpp>
+#include <aewt/pool.hpp>
 #include <aewt/client.hpp>
 #include <aewt/state.hpp>
 #include <boost/uuid/uuid_io.hpp>
@@ -52,18 +53,20 @@ namespace aewt {
         }
 
         state_->get_config()->clients_port_.store(acceptor_.local_endpoint().port(), std::memory_order_release);
-        LOG_INFO("state_id=[{}] clients is listening on [{}]", to_string(state_->get_id()), state_->get_config()->clients_port_.load(std::memory_order_acquire));
+        LOG_INFO("state_id=[{}] clients is listening on [{}]", state_->get_id(), state_->get_config()->clients_port_.load(std::memory_order_acquire));
     }
 
     void client_listener::on_accept(const boost::beast::error_code &ec, boost::asio::ip::tcp::socket socket) {
         if (ec) {
             LOG_INFO("listener failed on accept: {}", ec.what());
+
+            if (!acceptor_.is_open())
+                return;
         } else {
-            const auto _client = std::make_shared<client>(state_->get_id(), state_);
+            const auto _client = make_pooled<client>(state_->get_id(), state_);
             _client->set_socket(std::move(socket));
-            state_->add_client(_client);
-            const auto _ = state_->join_to_sessions(_client->get_id());
-            boost::ignore_unused(_);
+
+            // El registro y el anuncio a los pares ocurren tras el upgrade, un cliente retomado no los necesita
             _client->run();
         }
 
@@ -81,4 +84,11 @@ namespace aewt {
     void client_listener::start() {
         do_accept();
     }
+
+    void client_listener::stop() {
+        post(acceptor_.get_executor(), [_self = shared_from_this()] {
+            boost::beast::error_code _ec;
+            _self->acceptor_.close(_ec);
+        });
+    }
 } // namespace aewt
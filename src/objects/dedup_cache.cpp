@@ -0,0 +1,107 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/dedup_cache.hpp>
+
+#include <aewt/config.hpp>
+#include <aewt/utils.hpp>
+
+#include <algorithm>
+
+namespace aewt {
+    std::size_t dedup_cache::key_hash::operator()(const key &value) const {
+        return get_digest_hash(value.first) ^ get_digest_hash(value.second) * 0x9e3779b97f4a7c15ULL;
+    }
+
+    dedup_cache::dedup_cache(const std::shared_ptr<config> &config) : config_(config) {
+    }
+
+    dedup_cache::shard &dedup_cache::get_shard(const key &value) {
+        // Los UUID v1 y v7 comparten sus primeros bytes, se reparte por el hash completo de la clave
+        return shards_[(key_hash{}(value) >> 32) % shards_count];
+    }
+
+    void dedup_cache::evict(shard &shard, const std::chrono::steady_clock::time_point now) const {
+        const auto _window = std::chrono::seconds(config_->dedup_window_);
+        const auto _capacity = std::max<std::size_t>(config_->dedup_capacity_ / shards_count, 1);
+
+        while (!shard.order_.empty()) {
+            const auto &[_key, _stored_at] = shard.order_.front();
+            const auto _iterator = shard.entries_.find(_key);
+
+            // La clave pudo haber sido reemplazada o guardada de nuevo más atrás, solo se descarta su posición
+            if (_iterator == shard.entries_.end() || _iterator->second.stored_at_ != _stored_at) {
+                shard.order_.pop_front();
+                continue;
+            }
+
+            if (shard.entries_.size() <= _capacity && now - _iterator->second.stored_at_ < _window)
+                break;
+
+            shard.entries_.erase(_iterator);
+            shard.order_.pop_front();
+        }
+    }
+
+    std::optional<boost::json::object> dedup_cache::find(const boost::uuids::uuid entity_id,
+                                                         const boost::uuids::uuid transaction_id) {
+        if (config_->dedup_window_ == 0)
+            return std::nullopt;
+
+        const key _key{entity_id, transaction_id};
+        auto &_shard = get_shard(_key);
+
+        std::scoped_lock _lock(_shard.mutex_);
+
+        const auto _iterator = _shard.entries_.find(_key);
+        if (_iterator == _shard.entries_.end())
+            return std::nullopt;
+
+        if (std::chrono::steady_clock::now() - _iterator->second.stored_at_ >= std::chrono::seconds(
+                config_->dedup_window_))
+            return std::nullopt;
+
+        return _iterator->second.data_;
+    }
+
+    void dedup_cache::insert(const boost::uuids::uuid entity_id, const boost::uuids::uuid transaction_id,
+                             const boost::json::object &data) {
+        if (config_->dedup_window_ == 0)
+            return;
+
+        const key _key{entity_id, transaction_id};
+        auto &_shard = get_shard(_key);
+        const auto _now = std::chrono::steady_clock::now();
+
+        std::scoped_lock _lock(_shard.mutex_);
+
+        // Un reintento fuera de la ventana vuelve a guardarse, su posición pasa al final junto a su nuevo instante
+        _shard.entries_.insert_or_assign(_key, entry{data, _now});
+        _shard.order_.emplace_back(_key, _now);
+
+        evict(_shard, _now);
+    }
+
+    std::size_t dedup_cache::get_size() {
+        std::size_t _size = 0;
+
+        for (auto &_shard: shards_) {
+            std::scoped_lock _lock(_shard.mutex_);
+            _size += _shard.entries_.size();
+        }
+
+        return _size;
+    }
+} // namespace aewt
@@ -0,0 +1,39 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/deflate.hpp>
+
+#include <aewt/config.hpp>
+
+namespace aewt {
+    boost::beast::websocket::permessage_deflate get_deflate_options(const config &config, const bool enabled) {
+        boost::beast::websocket::permessage_deflate _options;
+
+        _options.server_enable = enabled;
+        _options.client_enable = enabled;
+
+        if (!enabled)
+            return _options;
+
+        _options.server_max_window_bits = config.deflate_window_bits_;
+        _options.client_max_window_bits = config.deflate_window_bits_;
+        _options.server_no_context_takeover = config.deflate_no_context_takeover_;
+        _options.compLevel = config.deflate_level_;
+        _options.memLevel = config.deflate_memory_level_;
+        _options.msg_size_threshold = config.deflate_threshold_;
+
+        return _options;
+    }
+} // namespace aewt
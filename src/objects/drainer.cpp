@@ -0,0 +1,124 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/drainer.hpp>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/strand.hpp>
+
+#include <aewt/client.hpp>
+#include <aewt/client_listener.hpp>
+#include <aewt/logger.hpp>
+#include <aewt/session.hpp>
+#include <aewt/session_listener.hpp>
+#include <aewt/state.hpp>
+
+namespace aewt {
+    /**
+     * Drain Poll Interval
+     */
+    static constexpr std::chrono::milliseconds drain_poll_interval{10};
+
+    /**
+     * Drain Close Grace
+     *
+     * Time the close frames get to go out once the deadline forced them.
+     */
+    static constexpr std::chrono::milliseconds drain_close_grace{250};
+
+    drainer::drainer(boost::asio::io_context &ioc, const std::shared_ptr<state> &state,
+                     const std::shared_ptr<session_listener> &session_listener,
+                     const std::shared_ptr<client_listener> &client_listener)
+        : state_(state), session_listener_(session_listener), client_listener_(client_listener),
+          timer_(make_strand(ioc)) {
+    }
+
+    void drainer::start() {
+        post(timer_.get_executor(), boost::beast::bind_front_handler(&drainer::on_start, shared_from_this()));
+    }
+
+    void drainer::on_start() {
+        deadline_ = std::chrono::steady_clock::now() + std::chrono::milliseconds(state_->get_config()->drain_timeout_);
+
+        if (session_listener_)
+            session_listener_->stop();
+
+        if (client_listener_)
+            client_listener_->stop();
+
+        const auto _sessions = state_->drain_to_sessions();
+
+        // Lo estacionado espera una reconexión que ya no puede llegar a este nodo
+        const auto _parked = state_->clear_parked_clients();
+
+        LOG_INFO("state_id=[{}] action=[drain] sessions=[{}] parked=[{}]", state_->get_id(), _sessions, _parked);
+
+        do_wait();
+    }
+
+    void drainer::do_wait() {
+        timer_.expires_after(drain_poll_interval);
+        timer_.async_wait(boost::beast::bind_front_handler(&drainer::on_wait, shared_from_this()));
+    }
+
+    void drainer::on_wait(const boost::beast::error_code &ec) {
+        if (ec)
+            return;
+
+        if (const auto _now = std::chrono::steady_clock::now(); _now >= deadline_) {
+            if (expired_) {
+                do_stop();
+                return;
+            }
+
+            LOG_INFO("state_id=[{}] action=[drain_expired] pending=[{}]", state_->get_id(),
+                     state_->get_overload_detector().get_pending());
+
+            // Lo que sigue conectado recibe su cierre igual, Beast lo encola tras la escritura en curso
+            expired_ = true;
+            deadline_ = _now + drain_close_grace;
+            do_close();
+            do_wait();
+            return;
+        }
+
+        if (!closing_) {
+            // Los frames de cierre salen recién cuando las colas quedaron vacías
+            if (state_->get_overload_detector().get_pending() == 0)
+                do_close();
+        } else if (state_->get_clients().empty() && state_->get_sessions().empty()) {
+            do_stop();
+            return;
+        }
+
+        do_wait();
+    }
+
+    void drainer::do_close() {
+        closing_ = true;
+
+        for (const auto &_client: state_->get_clients())
+            _client->close();
+
+        for (const auto &_session: state_->get_sessions())
+            _session->close();
+    }
+
+    void drainer::do_stop() {
+        LOG_INFO("state_id=[{}] action=[drained]", state_->get_id());
+
+        state_->get_ioc().stop();
+    }
+} // namespace aewt
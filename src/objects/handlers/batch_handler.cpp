@@ -0,0 +1,104 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/handlers/batch_handler.hpp>
+
+#include <aewt/state.hpp>
+#include <aewt/client.hpp>
+#include <aewt/kernel.hpp>
+#include <aewt/message.hpp>
+#include <aewt/request.hpp>
+#include <aewt/response.hpp>
+
+#include <aewt/validators/batch_validator.hpp>
+
+#include <aewt/utils.hpp>
+#include <aewt/logger.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+namespace aewt::handlers {
+    /**
+     * Get No Ack
+     *
+     * @param data
+     * @param fallback
+     * @return bool
+     */
+    static bool get_no_ack(const boost::json::object &data, const bool fallback) {
+        if (const auto _field = data.if_contains("no_ack"); _field != nullptr && _field->is_bool())
+            return _field->as_bool();
+        return fallback;
+    }
+
+    void batch_handler(const request &request) {
+        auto &_state = request.state_;
+
+        if (validators::batch_validator(request)) {
+            const auto &_params = get_params(request);
+            const auto &_requests = _params.at("requests").as_array();
+
+            std::optional<std::shared_ptr<client> > _client;
+            if (request.context_ == on_client)
+                _client = _state->get_client(request.entity_id_);
+
+            // Cada solicitud hereda el no_ack del batch, y este el negociado en la conexión
+            const auto _no_ack = get_no_ack(request.data_, _client.has_value() && _client.value()->get_no_ack());
+
+            // Solo un cliente puede recibir sus acks por separado, una sesión siempre los recibe juntos
+            const auto _stream = _client.has_value() && _params.contains("stream") && _params.at("stream").as_bool();
+
+            boost::json::array _responses;
+            if (!_stream)
+                _responses.reserve(_requests.size());
+
+            std::size_t _failed = 0;
+
+            for (const auto &_request: _requests) {
+                response _response;
+                kernel(_state, _request.as_object(), request.context_, request.entity_id_, _response);
+
+                if (_response.get_failed())
+                    ++_failed;
+
+                if (_response.is_ack())
+                    continue;
+
+                // Los errores siempre se informan, igual que fuera de un batch
+                if (!_response.get_failed() && get_no_ack(_request.as_object(), _no_ack))
+                    continue;
+
+                // Un batch sin ack no llega al cliente, lo que debe informarse se envía por separado
+                if (_stream || (_no_ack && _client.has_value()))
+                    _client.value()->send(make_message(_response.get_data()));
+                else
+                    _responses.emplace_back(_response.get_data());
+            }
+
+            LOG_INFO("state_id=[{}] action=[batch] context=[{}] entity_id=[{}] count=[{}] failed=[{}]",
+                     _state->get_id(), kernel_context_to_string(request.context_),
+                     request.entity_id_, _requests.size(), _failed);
+
+            boost::json::object _data = {
+                {"count", _requests.size()},
+                {"failed", _failed}
+            };
+
+            if (!_stream)
+                _data["responses"] = std::move(_responses);
+
+            next(request, "ok", _data);
+        }
+    }
+}
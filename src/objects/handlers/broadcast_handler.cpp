@@ -52,8 +52,8 @@ namespace aewt::handlers {
                     boost::ignore_unused(_);
 
                     LOG_INFO("state_id=[{}] action=[broadcast] context=[{}] client_id=[{}] count=[{}] size=[{}]",
-                             to_string(_state->get_id()), kernel_context_to_string(request.context_),
-                             to_string(request.entity_id_), _count, _payload.size());
+                             _state->get_id(), kernel_context_to_string(request.context_),
+                             request.entity_id_, _count, _payload.size());
 
                     break;
                 }
@@ -68,8 +68,8 @@ namespace aewt::handlers {
 
                     LOG_INFO(
                         "state_id=[{}] action=[broadcast] context=[{}] session_id=[{}] client_id=[{}] count=[{}] size=[{}]",
-                        to_string(_state->get_id()), kernel_context_to_string(request.context_),
-                        to_string(request.entity_id_), to_string(_client_id), _count, _payload.size());
+                        _state->get_id(), kernel_context_to_string(request.context_),
+                        request.entity_id_, _client_id, _count, _payload.size());
 
                     break;
                 }
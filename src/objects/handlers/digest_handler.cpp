@@ -0,0 +1,74 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/handlers/digest_handler.hpp>
+
+#include <aewt/state.hpp>
+#include <aewt/request.hpp>
+#include <aewt/session.hpp>
+
+#include <aewt/validators/digest_validator.hpp>
+
+#include <aewt/utils.hpp>
+#include <aewt/logger.hpp>
+#include <aewt/message.hpp>
+
+#include <boost/json/serialize.hpp>
+
+namespace aewt::handlers {
+    void digest_handler(const request &request) {
+        auto &_state = request.state_;
+
+        switch (request.context_) {
+            case on_client: {
+                LOG_INFO("state_id=[{}] action=[digest] context=[{}] client_id=[{}] status=[{}]",
+                         _state->get_id(), kernel_context_to_string(request.context_),
+                         request.entity_id_, "no effect");
+
+                next(request, "no effect");
+                break;
+            }
+            case on_session: {
+                if (validators::digest_validator(request)) {
+                    const auto &_params = get_params(request);
+                    const auto &_remote_digest = _params.at("buckets").as_array();
+                    const auto _local_digest = _state->get_digest(request.entity_id_);
+
+                    // Solo se solicitan los buckets cuyo hash difiere de lo que se conoce de la sesión.
+                    boost::json::array _buckets;
+                    for (std::size_t _bucket = 0; _bucket < digest_buckets; ++_bucket) {
+                        if (_remote_digest[_bucket].to_number<std::uint64_t>() != _local_digest[_bucket])
+                            _buckets.emplace_back(_bucket);
+                    }
+
+                    if (!_buckets.empty()) {
+                        if (const auto _session = _state->get_session(request.entity_id_); _session.has_value()) {
+                            _session.value()->send(make_message(make_reconcile_request_object(_buckets)));
+                        }
+                    }
+
+                    const auto _status = get_status(!_buckets.empty());
+
+                    LOG_INFO("state_id=[{}] action=[digest] context=[{}] session_id=[{}] buckets=[{}] status=[{}]",
+                             _state->get_id(), kernel_context_to_string(request.context_),
+                             request.entity_id_, _buckets.size(), _status);
+
+                    next(request, _status, {{"buckets", _buckets}});
+                }
+                break;
+            }
+        }
+    }
+}
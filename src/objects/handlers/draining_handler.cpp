@@ -0,0 +1,60 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/handlers/draining_handler.hpp>
+
+#include <aewt/state.hpp>
+#include <aewt/request.hpp>
+#include <aewt/session.hpp>
+
+#include <aewt/utils.hpp>
+#include <aewt/logger.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+namespace aewt::handlers {
+    void draining_handler(const request &request) {
+        auto &_state = request.state_;
+
+        switch (request.context_) {
+            case on_client: {
+                LOG_INFO("state_id=[{}] action=[draining] context=[{}] client_id=[{}] status=[{}]",
+                         _state->get_id(), kernel_context_to_string(request.context_),
+                         request.entity_id_, "no effect");
+
+                next(request, "no effect");
+                break;
+            }
+            case on_session: {
+                // La sesión sigue leyendo hasta recibir el cierre, pero deja de ser destino de cualquier envío
+                const auto _session = _state->get_session(request.entity_id_);
+                const auto _removed = _state->remove_session(request.entity_id_);
+                _state->remove_state_of_session(request.entity_id_);
+
+                // Si este estado también se drena ya no la encontrará entre sus sesiones para cerrarla
+                if (_session.has_value() && _state->get_draining())
+                    _session.value()->close();
+
+                const auto _status = get_status(_removed);
+
+                LOG_INFO("state_id=[{}] action=[draining] context=[{}] session_id=[{}] status=[{}]",
+                         _state->get_id(), kernel_context_to_string(request.context_),
+                         request.entity_id_, _status);
+
+                next(request, _status);
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,68 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/handlers/interest_handler.hpp>
+
+#include <aewt/state.hpp>
+#include <aewt/request.hpp>
+
+#include <aewt/validators/interest_validator.hpp>
+
+#include <aewt/utils.hpp>
+#include <aewt/logger.hpp>
+
+namespace aewt::handlers {
+    void interest_handler(const request &request) {
+        auto &_state = request.state_;
+
+        switch (request.context_) {
+            case on_client: {
+                LOG_INFO("state_id=[{}] action=[interest] context=[{}] client_id=[{}] status=[{}]",
+                         _state->get_id(), kernel_context_to_string(request.context_),
+                         request.entity_id_, "no effect");
+
+                next(request, "no effect");
+                break;
+            }
+            case on_session: {
+                if (validators::interest_validator(request)) {
+                    const auto &_params = get_params(request);
+
+                    std::vector<std::string> _add;
+                    for (const auto &_channel: _params.at("add").as_array())
+                        _add.emplace_back(_channel.as_string());
+
+                    std::vector<std::string> _remove;
+                    for (const auto &_channel: _params.at("remove").as_array())
+                        _remove.emplace_back(_channel.as_string());
+
+                    const auto _added = _state->push_interests(request.entity_id_, _add);
+                    const auto _removed = _state->pull_interests(request.entity_id_, _remove);
+                    const auto _status = get_status(_added + _removed > 0);
+
+                    LOG_INFO("state_id=[{}] action=[interest] context=[{}] session_id=[{}] added=[{}] removed=[{}] status=[{}]",
+                             _state->get_id(), kernel_context_to_string(request.context_),
+                             request.entity_id_, _added, _removed, _status);
+
+                    next(request, _status, {
+                             {"added", _added},
+                             {"removed", _removed}
+                         });
+                }
+                break;
+            }
+        }
+    }
+}
@@ -39,8 +39,8 @@ namespace aewt::handlers {
                     const auto _status = get_status(_success, "yes", "no");
 
                     LOG_INFO("state_id=[{}] action=[is_subscribed] context=[{}] client_id=[{}] status=[{}]",
-                             to_string(_state->get_id()), kernel_context_to_string(request.context_),
-                             to_string(request.entity_id_), _status);
+                             _state->get_id(), kernel_context_to_string(request.context_),
+                             request.entity_id_, _status);
 
                     next(request, _status);
                     break;
@@ -49,8 +49,8 @@ namespace aewt::handlers {
                     next(request, "no effect");
 
                     LOG_INFO("state_id=[{}] action=[is_subscribed] context=[{}] session_id=[{}] status=[{}]",
-                             to_string(_state->get_id()), kernel_context_to_string(request.context_),
-                             to_string(request.entity_id_), "no effect");
+                             _state->get_id(), kernel_context_to_string(request.context_),
+                             request.entity_id_, "no effect");
 
                     break;
                 }
@@ -31,8 +31,8 @@ namespace aewt::handlers {
         switch (request.context_) {
             case on_client: {
                 LOG_INFO("state_id=[{}] action=[join] context=[{}] client_id=[{}] status=[{}]",
-                         to_string(_state->get_id()), kernel_context_to_string(request.context_),
-                         to_string(request.entity_id_), "no effect");
+                         _state->get_id(), kernel_context_to_string(request.context_),
+                         request.entity_id_, "no effect");
 
                 next(request, "no effect");
                 break;
@@ -41,13 +41,12 @@ namespace aewt::handlers {
                 if (const auto &_params = get_params(request);
                     validators::id_validator(request, _params, "client_id")) {
                     auto _client_id = get_param_as_id(_params, "client_id");
-                    const auto _inserted = _state->add_client(
-                        std::make_shared<client>(request.entity_id_, _state, _client_id));
+                    const auto _inserted = _state->push_remote_client({_client_id, request.entity_id_});
                     const auto _status = get_status(_inserted);
 
                     LOG_INFO("state_id=[{}] action=[join] context=[{}] session_id=[{}] client_id=[{}] status=[{}]",
-                             to_string(_state->get_id()), kernel_context_to_string(request.context_),
-                             to_string(request.entity_id_), to_string(_client_id), _status);
+                             _state->get_id(), kernel_context_to_string(request.context_),
+                             request.entity_id_, _client_id, _status);
                     next(request, _status);
                 }
                 break;
@@ -31,8 +31,8 @@ namespace aewt::handlers {
         switch (request.context_) {
             case on_client: {
                 LOG_INFO("state_id=[{}] action=[leave] context=[{}] client_id=[{}] status=[{}]",
-                         to_string(_state->get_id()), kernel_context_to_string(request.context_),
-                         to_string(request.entity_id_), "no effect");
+                         _state->get_id(), kernel_context_to_string(request.context_),
+                         request.entity_id_, "no effect");
 
                 next(request, "no effect");
                 break;
@@ -45,8 +45,8 @@ namespace aewt::handlers {
                     const auto _status = get_status(_removed);
 
                     LOG_INFO("state_id=[{}] action=[leave] context=[{}] session_id=[{}] client_id=[{}] status=[{}]",
-                             to_string(_state->get_id()), kernel_context_to_string(request.context_),
-                             to_string(request.entity_id_), to_string(_client_id), _status);
+                             _state->get_id(), kernel_context_to_string(request.context_),
+                             request.entity_id_, _client_id, _status);
                     next(request, _status);
                 }
                 break;
@@ -57,8 +57,8 @@ namespace aewt::handlers {
 
                     LOG_INFO(
                         "state_id=[{}] action=[publish] context=[{}] client_id=[{}] channel=[{}] count=[{}] size=[{}]",
-                        to_string(request.state_->get_id()), kernel_context_to_string(request.context_),
-                        to_string(request.entity_id_), _channel, _count, _payload.size());
+                        request.state_->get_id(), kernel_context_to_string(request.context_),
+                        request.entity_id_, _channel, _count, _payload.size());
                     break;
                 }
                 case on_session: {
@@ -73,8 +73,8 @@ namespace aewt::handlers {
 
                     LOG_INFO(
                         "state_id=[{}] action=[publish] context=[{}] session_id=[{}] client_id=[{}] channel=[{}] count=[{}] size=[{}]",
-                        to_string(request.state_->get_id()), kernel_context_to_string(request.context_),
-                        to_string(request.entity_id_), to_string(_client_id), _channel, _count, _payload.size());
+                        request.state_->get_id(), kernel_context_to_string(request.context_),
+                        request.entity_id_, _client_id, _channel, _count, _payload.size());
 
                     break;
                 }
@@ -0,0 +1,61 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/handlers/reconcile_handler.hpp>
+
+#include <aewt/state.hpp>
+#include <aewt/request.hpp>
+#include <aewt/session.hpp>
+
+#include <aewt/validators/reconcile_validator.hpp>
+
+#include <aewt/utils.hpp>
+#include <aewt/logger.hpp>
+
+namespace aewt::handlers {
+    void reconcile_handler(const request &request) {
+        auto &_state = request.state_;
+
+        switch (request.context_) {
+            case on_client: {
+                LOG_INFO("state_id=[{}] action=[reconcile] context=[{}] client_id=[{}] status=[{}]",
+                         _state->get_id(), kernel_context_to_string(request.context_),
+                         request.entity_id_, "no effect");
+
+                next(request, "no effect");
+                break;
+            }
+            case on_session: {
+                if (validators::reconcile_validator(request)) {
+                    const auto &_params = get_params(request);
+                    const auto _buckets = get_values_as_buckets(_params.at("buckets").as_array());
+
+                    std::size_t _messages = 0;
+                    if (const auto _session = _state->get_session(request.entity_id_); _session.has_value())
+                        _messages = _state->reconcile(_session.value(), _buckets);
+
+                    const auto _status = get_status(_messages > 0);
+
+                    LOG_INFO("state_id=[{}] action=[reconcile] context=[{}] session_id=[{}] messages=[{}] status=[{}]",
+                             _state->get_id(), kernel_context_to_string(request.context_),
+                             request.entity_id_, _messages, _status);
+
+                    next(request, _status, {{"messages", _messages}});
+                }
+                break;
+            }
+        }
+    }
+}
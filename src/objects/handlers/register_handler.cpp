@@ -50,8 +50,8 @@ namespace aewt::handlers {
 
                         LOG_INFO(
                             "state_id=[{}] action=[register] context=[{}] session_id=[{}] sessions_port=[{}] clients_port=[{}] registered=[{}] status=[ok]",
-                            to_string(request.state_->get_id()), kernel_context_to_string(request.context_),
-                            to_string(request.entity_id_), _sessions_port, _clients_port, _registered);
+                            request.state_->get_id(), kernel_context_to_string(request.context_),
+                            request.entity_id_, _sessions_port, _clients_port, _registered);
 
                         _state->sync(_instance, _registered);
 
@@ -60,7 +60,7 @@ namespace aewt::handlers {
                         next(request, "no effect");
 
                         LOG_INFO("state_id=[{}] action=[register] context=[{}] status=[no effect]",
-                                 to_string(request.state_->get_id()), kernel_context_to_string(request.context_));
+                                 request.state_->get_id(), kernel_context_to_string(request.context_));
                     }
                 }
                 break;
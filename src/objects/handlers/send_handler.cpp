@@ -27,6 +27,7 @@
 #include <boost/uuid/uuid_io.hpp>
 #include <boost/json/serialize.hpp>
 #include <aewt/logger.hpp>
+#include <aewt/message.hpp>
 
 namespace aewt::handlers {
     void send_handler(const request &request) {
@@ -39,38 +40,36 @@ namespace aewt::handlers {
             switch (request.context_) {
                 case on_client: {
                     if (const auto _client = _state->get_client(_to_client_id); _client.has_value()) {
-                        if (const auto &_scoped_client = _client.value();
-                            _scoped_client->get_session_id() == _state->get_id()) {
-                            const boost::json::object _data = {
-                                {"transaction_id", to_string(boost::uuids::random_generator()())},
-                                {"action", "send"},
-                                {
-                                    "params", {
-                                        {"from_client_id", to_string(request.entity_id_)},
-                                        {"to_client_id", to_string(_scoped_client->get_id())},
-                                        {"payload", _payload},
-                                    }
+                        const auto &_scoped_client = _client.value();
+                        const boost::json::object _data = {
+                            {"transaction_id", to_string(boost::uuids::random_generator()())},
+                            {"action", "send"},
+                            {
+                                "params", {
+                                    {"from_client_id", to_string(request.entity_id_)},
+                                    {"to_client_id", to_string(_scoped_client->get_id())},
+                                    {"payload", _payload},
                                 }
-                            };
-                            _scoped_client->send(std::make_shared<std::string const>(serialize(_data)));
+                            }
+                        };
+                        _scoped_client->send(make_message(_data));
 
-                            LOG_INFO(
-                                "state_id=[{}] action=[send] context=[{}] from_client_id=[{}] to_client_id=[{}] status=[ok] size=[{}]",
-                                to_string(request.state_->get_id()), kernel_context_to_string(request.context_),
-                                to_string(request.entity_id_), to_string(_scoped_client->get_id()), _payload.size());
+                        LOG_INFO(
+                            "state_id=[{}] action=[send] context=[{}] from_client_id=[{}] to_client_id=[{}] status=[ok] size=[{}]",
+                            request.state_->get_id(), kernel_context_to_string(request.context_),
+                            request.entity_id_, _scoped_client->get_id(), _payload.size());
 
-                            next(request, "ok");
-                        } else {
-                            _state->send_to_session(_scoped_client->get_session_id(), request.entity_id_,
-                                                    _scoped_client->get_id(), _payload);
+                        next(request, "ok");
+                    } else if (const auto _session_id = _state->get_client_session(_to_client_id);
+                        _session_id.has_value()) {
+                        _state->send_to_session(_session_id.value(), request.entity_id_, _to_client_id, _payload);
 
-                            LOG_INFO(
-                                "state_id=[{}] action=[send] context=[{}] from_client_id=[{}] to_client_id=[{}] status=[ok] size=[{}]",
-                                to_string(request.state_->get_id()), kernel_context_to_string(request.context_),
-                                to_string(request.entity_id_), to_string(_scoped_client->get_id()), _payload.size());
+                        LOG_INFO(
+                            "state_id=[{}] action=[send] context=[{}] from_client_id=[{}] to_client_id=[{}] status=[ok] size=[{}]",
+                            request.state_->get_id(), kernel_context_to_string(request.context_),
+                            request.entity_id_, _to_client_id, _payload.size());
 
-                            next(request, "ok");
-                        }
+                        next(request, "ok");
                     } else {
                         next(request, "no effect");
                     }
@@ -92,12 +91,12 @@ namespace aewt::handlers {
                                     }
                                 }
                             };
-                            _scoped_client->send(std::make_shared<std::string const>(serialize(_data)));
+                            _scoped_client->send(make_message(_data));
 
                             LOG_INFO(
                                 "state_id=[{}] action=[send] context=[{}] from_client_id=[{}] to_client_id=[{}] status=[ok] size=[{}]",
-                                to_string(request.state_->get_id()), kernel_context_to_string(request.context_),
-                                to_string(_from_client_id), to_string(_scoped_client->get_id()), _payload.size());
+                                request.state_->get_id(), kernel_context_to_string(request.context_),
+                                _from_client_id, _scoped_client->get_id(), _payload.size());
                             next(request, "ok");
                         } else {
                             next(request, "no effect");
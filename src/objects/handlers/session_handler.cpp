@@ -14,6 +14,7 @@
 // along with this program. If not, see <https://www.gnu.org/licenses/>.
 
 #include <aewt/logger.hpp>
+#include <aewt/pool.hpp>
 #include <aewt/handlers/session_handler.hpp>
 
 #include <aewt/state.hpp>
@@ -55,7 +56,7 @@ namespace aewt::handlers {
                     if (!_found) {
                         boost::asio::ip::tcp::resolver _resolver{make_strand(_state->get_ioc())};
                         auto const _results = _resolver.resolve(_host, std::to_string(_sessions_port));
-                        const auto _remote_session = std::make_shared<session>(
+                        const auto _remote_session = make_pooled<session>(
                             _state, boost::asio::ip::tcp::socket{make_strand(_state->get_ioc())});
                         auto &_socket = _remote_session->get_socket();
                         auto &_lowest_socket = _socket.next_layer().socket().lowest_layer();
@@ -75,13 +76,13 @@ namespace aewt::handlers {
                         _state->add_session(_remote_session);
                         LOG_INFO(
                             "state_id=[{}] action=[session] context=[{}] session_id=[{}] host=[{}] sessions_port=[{}] clients_port=[{}] status=[ok]",
-                            to_string(request.state_->get_id()), kernel_context_to_string(request.context_),
-                            to_string(_remote_session->get_id()), _host, _sessions_port, _clients_port);
+                            request.state_->get_id(), kernel_context_to_string(request.context_),
+                            _remote_session->get_id(), _host, _sessions_port, _clients_port);
 
                         next(request, "ok");
                     } else {
                         LOG_INFO("state_id=[{}] action=[session] context=[{}] status=[no effect]",
-                                 to_string(request.state_->get_id()), kernel_context_to_string(request.context_));
+                                 request.state_->get_id(), kernel_context_to_string(request.context_));
 
                         next(request, "no effect");
                     }
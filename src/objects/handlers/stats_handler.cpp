@@ -0,0 +1,52 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/handlers/stats_handler.hpp>
+
+#include <aewt/request.hpp>
+#include <aewt/state.hpp>
+
+#include <aewt/utils.hpp>
+#include <aewt/logger.hpp>
+
+#include <boost/json/array.hpp>
+
+namespace aewt::handlers {
+    void stats_handler(const request &request) {
+        const auto &_overload_detector = request.state_->get_overload_detector();
+        const auto _stats = request.state_->get_loop_monitor().get_stats();
+
+        boost::json::array _threads;
+        _threads.reserve(_stats.size());
+
+        for (const auto &_thread_stats: _stats) {
+            _threads.emplace_back(boost::json::object{
+                {"lag", _thread_stats.lag_.count()},
+                {"handlers_per_second", _thread_stats.handlers_per_second_},
+                {"busy", _thread_stats.busy_},
+            });
+        }
+
+        LOG_INFO("state_id=[{}] action=[stats] context=[{}] threads=[{}]", request.state_->get_id(),
+                 kernel_context_to_string(request.context_), _stats.size());
+
+        next(request, "ok", {
+                 {"threads", std::move(_threads)},
+                 {"pending", _overload_detector.get_pending()},
+                 {"lag", _overload_detector.get_lag().count()},
+                 {"overloaded", _overload_detector.get_overloaded()},
+             });
+    }
+}
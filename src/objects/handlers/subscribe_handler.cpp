@@ -16,6 +16,7 @@
 #include <aewt/handlers/subscribe_handler.hpp>
 
 #include <aewt/state.hpp>
+#include <aewt/client.hpp>
 #include <aewt/request.hpp>
 
 #include <aewt/validators/subscriptions_validator.hpp>
@@ -36,13 +37,27 @@ namespace aewt::handlers {
                 case on_client: {
                     const bool _success = _state->subscribe(_state->get_id(), request.entity_id_, _channel);
                     const auto _status = get_status(_success);
-                    next(request, _status);
 
-                    auto _ = _state->subscribe_to_sessions(request, request.entity_id_, _channel);
-                    boost::ignore_unused(_);
+                    // Las publicaciones retenidas se encolan antes de la respuesta, ya serializadas
+                    if (_success && _params.contains("since")) {
+                        const auto _since = _params.at("since").to_number<std::uint64_t>();
+                        const auto _messages = _state->get_history().replay(_channel, _since);
+
+                        if (const auto _client = _state->get_client(request.entity_id_); _client.has_value()) {
+                            for (const auto &_message: _messages)
+                                _client.value()->send(_message);
+                        }
+
+                        next(request, _status, {
+                                 {"replayed", _messages.size()}
+                             });
+                    } else {
+                        next(request, _status);
+                    }
+
                     LOG_INFO("state_id=[{}] action=[subscribe] context=[{}] client_id=[{}] channel=[{}] status=[{}]",
-                             to_string(_state->get_id()), kernel_context_to_string(request.context_),
-                             to_string(request.entity_id_), _channel, _status);
+                             _state->get_id(), kernel_context_to_string(request.context_),
+                             request.entity_id_, _channel, _status);
                 }
                 break;
                 case on_session: {
@@ -52,8 +67,8 @@ namespace aewt::handlers {
 
                     LOG_INFO(
                         "state_id=[{}] action=[subscribe] context=[{}] session_id=[{}] client_id=[{}] channel=[{}] status=[{}]",
-                        to_string(_state->get_id()), kernel_context_to_string(request.context_),
-                        to_string(request.entity_id_), to_string(_client_id), _channel, _status);
+                        _state->get_id(), kernel_context_to_string(request.context_),
+                        request.entity_id_, _client_id, _channel, _status);
                     next(request, _status);
                 }
                 break;
@@ -0,0 +1,80 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/handlers/sync_handler.hpp>
+
+#include <aewt/state.hpp>
+#include <aewt/request.hpp>
+
+#include <aewt/validators/sync_validator.hpp>
+
+#include <aewt/utils.hpp>
+#include <aewt/logger.hpp>
+
+namespace aewt::handlers {
+    void sync_handler(const request &request) {
+        auto &_state = request.state_;
+
+        switch (request.context_) {
+            case on_client: {
+                LOG_INFO("state_id=[{}] action=[sync] context=[{}] client_id=[{}] status=[{}]",
+                         _state->get_id(), kernel_context_to_string(request.context_),
+                         request.entity_id_, "no effect");
+
+                next(request, "no effect");
+                break;
+            }
+            case on_session: {
+                if (validators::sync_validator(request)) {
+                    const auto &_params = get_params(request);
+                    const auto &_clients = _params.at("clients").as_array();
+                    const auto &_interests = _params.at("interests").as_array();
+
+                    std::vector<remote_client> _remote_clients;
+                    _remote_clients.reserve(_clients.size());
+                    for (const auto &_client_id: _clients)
+                        _remote_clients.push_back({get_value_as_id(_client_id), request.entity_id_});
+
+                    std::vector<std::string> _channels;
+                    _channels.reserve(_interests.size());
+                    for (const auto &_channel: _interests)
+                        _channels.emplace_back(_channel.as_string());
+
+                    // Cuando proviene de una reconciliación se descartan primero las filas de los buckets indicados.
+                    std::size_t _removed = 0;
+                    if (_params.contains("reset"))
+                        _removed = _state->remove_state_of_buckets(
+                            request.entity_id_, get_values_as_buckets(_params.at("reset").as_array()));
+
+                    const auto _pushed_clients = _state->push_remote_clients(_remote_clients);
+                    const auto _pushed_interests = _state->push_interests(request.entity_id_, _channels);
+                    const auto _status = get_status(_removed + _pushed_clients + _pushed_interests > 0);
+
+                    LOG_INFO(
+                        "state_id=[{}] action=[sync] context=[{}] session_id=[{}] removed=[{}] clients=[{}] interests=[{}] status=[{}]",
+                        _state->get_id(), kernel_context_to_string(request.context_),
+                        request.entity_id_, _removed, _pushed_clients, _pushed_interests, _status);
+
+                    next(request, _status, {
+                             {"removed", _removed},
+                             {"clients", _pushed_clients},
+                             {"interests", _pushed_interests}
+                         });
+                }
+                break;
+            }
+        }
+    }
+}
@@ -38,12 +38,9 @@ namespace aewt::handlers {
                     const auto _status = get_status(_success);
                     next(request, _status);
 
-                    auto _ = _state->unsubscribe_to_sessions(request, request.entity_id_, _channel);
-                    boost::ignore_unused(_);
-
                     LOG_INFO("state_id=[{}] action=[unsubscribe] context=[{}] client_id=[{}] channel=[{}] status=[{}]",
-                             to_string(_state->get_id()), kernel_context_to_string(request.context_),
-                             to_string(request.entity_id_), _channel, _status);
+                             _state->get_id(), kernel_context_to_string(request.context_),
+                             request.entity_id_, _channel, _status);
                 }
                 break;
                 case on_session: {
@@ -53,8 +50,8 @@ namespace aewt::handlers {
 
                     LOG_INFO(
                         "state_id=[{}] action=[unsubscribe] context=[{}] session_id=[{}] client_id=[{}] channel=[{}] status=[{}]",
-                        to_string(_state->get_id()), kernel_context_to_string(request.context_),
-                        to_string(request.entity_id_), to_string(_client_id), _channel, _status);
+                        _state->get_id(), kernel_context_to_string(request.context_),
+                        request.entity_id_, _client_id, _channel, _status);
 
                     next(request, _status);
                 }
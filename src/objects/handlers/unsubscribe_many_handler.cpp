@@ -0,0 +1,63 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/handlers/unsubscribe_many_handler.hpp>
+
+#include <aewt/state.hpp>
+#include <aewt/request.hpp>
+
+#include <aewt/validators/subscriptions_many_validator.hpp>
+
+#include <aewt/utils.hpp>
+#include <aewt/logger.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include <algorithm>
+
+namespace aewt::handlers {
+    void unsubscribe_many_handler(const request &request) {
+        auto &_state = request.state_;
+
+        if (validators::subscriptions_many_validator(request)) {
+            const auto &_params = get_params(request);
+            const auto _channels = get_values_as_strings(_params.at("channels").as_array());
+
+            const auto _session_id = request.context_ == on_client ? _state->get_id() : request.entity_id_;
+            const auto _client_id = request.context_ == on_client
+                                        ? request.entity_id_
+                                        : get_param_as_id(_params, "client_id");
+
+            const auto _results = _state->unsubscribe_many(_session_id, _client_id, _channels);
+
+            // Un canal repetido conserva el resultado de su primera aparición
+            boost::json::object _statuses;
+            for (std::size_t _position = 0; _position < _channels.size(); ++_position)
+                _statuses.emplace(_channels[_position], get_status(_results[_position]));
+
+            const auto _count = std::ranges::count(_results, true);
+            const auto _status = get_status(_count > 0);
+
+            LOG_INFO(
+                "state_id=[{}] action=[unsubscribe_many] context=[{}] session_id=[{}] client_id=[{}] channels=[{}] count=[{}] status=[{}]",
+                _state->get_id(), kernel_context_to_string(request.context_),
+                _session_id, _client_id, _channels.size(), _count, _status);
+
+            next(request, _status, {
+                     {"count", _count},
+                     {"channels", _statuses}
+                 });
+        }
+    }
+}
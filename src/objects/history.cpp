@@ -0,0 +1,145 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/history.hpp>
+
+#include <aewt/channel_trie.hpp>
+#include <aewt/config.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+namespace aewt {
+    history::history(const std::shared_ptr<config> &config) : config_(config) {
+    }
+
+    bool history::get_enabled() const {
+        return config_->history_size_ > 0;
+    }
+
+    std::uint64_t history::next_sequence() {
+        std::lock_guard _lock(mutex_);
+        return ++sequence_;
+    }
+
+    void history::evict(ring &ring, const std::chrono::steady_clock::time_point now) {
+        const auto _window = std::chrono::seconds(config_->history_window_);
+
+        while (!ring.records_.empty()) {
+            const auto &_record = ring.records_.front();
+
+            const auto _overflow = ring.records_.size() > config_->history_size_;
+            const auto _expired = config_->history_window_ > 0 && now - _record.stored_at_ >= _window;
+
+            if (!_overflow && !_expired)
+                break;
+
+            bytes_ -= _record.data_.get_size();
+            ring.records_.pop_front();
+        }
+    }
+
+    void history::collect(const ring &ring, const std::uint64_t since, std::vector<record> &output) {
+        const auto _first = std::ranges::upper_bound(ring.records_, since, {}, &record::sequence_);
+        output.insert(output.end(), _first, ring.records_.end());
+    }
+
+    void history::push(const std::string &channel, const std::uint64_t sequence, const message &data) {
+        if (!get_enabled())
+            return;
+
+        std::lock_guard _lock(mutex_);
+
+        const auto _now = std::chrono::steady_clock::now();
+
+        auto [_iterator, _inserted] = rings_.try_emplace(channel);
+        auto &_ring = _iterator->second;
+
+        if (_inserted) {
+            order_.push_front(channel);
+            _ring.position_ = order_.begin();
+        } else {
+            order_.splice(order_.begin(), order_, _ring.position_);
+        }
+
+        // Dos publicaciones concurrentes pueden llegar con la secuencia invertida, se ordena desde el final
+        auto _position = _ring.records_.end();
+        while (_position != _ring.records_.begin() && std::prev(_position)->sequence_ > sequence)
+            --_position;
+
+        _ring.records_.insert(_position, record{sequence, _now, data});
+        bytes_ += data.get_size();
+
+        evict(_ring, _now);
+
+        // Sobre la capacidad global se descartan primero los registros del canal usado hace más tiempo
+        while (bytes_ > config_->history_capacity_ && !order_.empty()) {
+            const auto _last = rings_.find(order_.back());
+            auto &_records = _last->second.records_;
+
+            if (!_records.empty()) {
+                bytes_ -= _records.front().data_.get_size();
+                _records.pop_front();
+            }
+
+            if (_records.empty()) {
+                rings_.erase(_last);
+                order_.pop_back();
+            }
+        }
+    }
+
+    std::vector<message> history::replay(const std::string &channel, const std::uint64_t since) {
+        std::vector<message> _result;
+        if (!get_enabled())
+            return _result;
+
+        std::lock_guard _lock(mutex_);
+
+        const auto _now = std::chrono::steady_clock::now();
+
+        std::vector<record> _records;
+
+        if (channel_trie::is_pattern(channel)) {
+            for (auto &[_name, _ring]: rings_) {
+                if (!channel_trie::matches(channel, _name))
+                    continue;
+
+                evict(_ring, _now);
+                collect(_ring, since, _records);
+            }
+
+            std::ranges::sort(_records, {}, &record::sequence_);
+        } else if (const auto _iterator = rings_.find(channel); _iterator != rings_.end()) {
+            auto &_ring = _iterator->second;
+
+            evict(_ring, _now);
+            collect(_ring, since, _records);
+
+            order_.splice(order_.begin(), order_, _ring.position_);
+        }
+
+        _result.reserve(_records.size());
+        for (auto &_record: _records)
+            _result.push_back(std::move(_record.data_));
+
+        return _result;
+    }
+
+    std::size_t history::get_bytes() {
+        std::lock_guard _lock(mutex_);
+        return bytes_;
+    }
+} // namespace aewt
@@ -21,31 +21,40 @@
 #include <aewt/session.hpp>
 #include <aewt/state.hpp>
 #include <aewt/logger.hpp>
+#include <aewt/pool.hpp>
 #include <aewt/validator.hpp>
 
 #include <aewt/handlers/ping_handler.hpp>
+#include <aewt/handlers/stats_handler.hpp>
 #include <aewt/handlers/register_handler.hpp>
 #include <aewt/handlers/session_handler.hpp>
 
 #include <aewt/handlers/join_handler.hpp>
 #include <aewt/handlers/leave_handler.hpp>
+#include <aewt/handlers/sync_handler.hpp>
+#include <aewt/handlers/digest_handler.hpp>
+#include <aewt/handlers/reconcile_handler.hpp>
+#include <aewt/handlers/draining_handler.hpp>
 
 #include <aewt/handlers/subscribe_handler.hpp>
+#include <aewt/handlers/subscribe_many_handler.hpp>
 
 #include <aewt/handlers/unsubscribe_handler.hpp>
+#include <aewt/handlers/unsubscribe_many_handler.hpp>
+#include <aewt/handlers/interest_handler.hpp>
 
 #include <aewt/handlers/is_subscribed_handler.hpp>
 
 #include <aewt/handlers/broadcast_handler.hpp>
 #include <aewt/handlers/publish_handler.hpp>
 #include <aewt/handlers/send_handler.hpp>
+#include <aewt/handlers/batch_handler.hpp>
 
 #include <aewt/handlers/unimplemented_handler.hpp>
 
 #include <aewt/utils.hpp>
 
 #include <boost/json/serialize.hpp>
-#include <boost/core/ignore_unused.hpp>
 #include <boost/uuid/random_generator.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
@@ -54,15 +63,22 @@ namespace aewt {
                                      const boost::json::object &data,
                                      const kernel_context context,
                                      const boost::uuids::uuid entity_id) {
-        boost::ignore_unused(state);
+        auto _response = make_pooled<response>();
+        kernel(state, data, context, entity_id, *_response);
+        return _response;
+    }
 
+    void kernel(const std::shared_ptr<state> &state,
+                const boost::json::object &data,
+                const kernel_context context,
+                const boost::uuids::uuid entity_id,
+                response &response) {
         const auto _timestamp = std::chrono::system_clock::now().time_since_epoch().count();
 
-        auto _response = std::make_shared<response>();
         if (const validator _validator(data); _validator.get_passed()) {
             const auto _request = request{
                 .transaction_id_ = get_param_as_id(data, "transaction_id"),
-                .response_ = _response,
+                .response_ = response,
                 .entity_id_ = entity_id,
                 .context_ = context,
                 .state_ = state,
@@ -70,8 +86,40 @@ namespace aewt {
                 .timestamp_ = _timestamp,
             };
 
-            if (const std::string _action{data.at("action").as_string()}; _action == "ping") {
+            const std::string _action{data.at("action").as_string()};
+
+            // Los reintentos de acciones con fan-out reciben el mismo ack sin volver a ejecutarse
+            const auto _is_retryable = _action == "publish" || _action == "broadcast" || _action == "send";
+            if (_is_retryable) {
+                if (const auto _cached = state->get_dedup_cache().find(entity_id, _request.transaction_id_);
+                    _cached.has_value()) {
+                    response.set_data(_cached.value());
+                    response.mark_as_processed();
+                    return;
+                }
+            }
+
+            // Los clientes se limitan antes del despacho, las sesiones son nodos del cluster y no se descartan
+            if (context == on_client) {
+                const auto _is_fanout = _is_retryable || _action == "batch";
+
+                if (_is_fanout && state->get_overload_detector().get_overloaded()) {
+                    response.mark_as_failed(_request.transaction_id_, "service unavailable", _timestamp, {});
+                    response.mark_as_processed();
+                    return;
+                }
+
+                if (!state->get_rate_limiter().try_acquire(entity_id, _is_fanout)) {
+                    response.mark_as_failed(_request.transaction_id_, "too many requests", _timestamp, {});
+                    response.mark_as_processed();
+                    return;
+                }
+            }
+
+            if (_action == "ping") {
                 handlers::ping_handler(_request);
+            } else if (_action == "stats") {
+                handlers::stats_handler(_request);
             } else if (_action == "send") {
                 handlers::send_handler(_request);
             } else if (_action == "register") {
@@ -79,37 +127,54 @@ namespace aewt {
             } else if (_action == "session") {
                 handlers::session_handler(_request);
             } else if (_action == "ack") {
-                _response->mark_as_ack();
+                response.mark_as_ack();
             } else if (_action == "subscribe") {
                 handlers::subscribe_handler(_request);
+            } else if (_action == "subscribe_many") {
+                handlers::subscribe_many_handler(_request);
             } else if (_action == "is_subscribed") {
                 handlers::is_subscribed_handler(_request);
             } else if (_action == "unsubscribe") {
                 handlers::unsubscribe_handler(_request);
+            } else if (_action == "unsubscribe_many") {
+                handlers::unsubscribe_many_handler(_request);
+            } else if (_action == "interest") {
+                handlers::interest_handler(_request);
             } else if (_action == "broadcast") {
                 handlers::broadcast_handler(_request);
             } else if (_action == "publish") {
                 handlers::publish_handler(_request);
+            } else if (_action == "batch") {
+                handlers::batch_handler(_request);
             } else if (_action == "join") {
                 handlers::join_handler(_request);
             } else if (_action == "leave") {
                 handlers::leave_handler(_request);
+            } else if (_action == "sync") {
+                handlers::sync_handler(_request);
+            } else if (_action == "digest") {
+                handlers::digest_handler(_request);
+            } else if (_action == "reconcile") {
+                handlers::reconcile_handler(_request);
+            } else if (_action == "draining") {
+                handlers::draining_handler(_request);
             } else {
                 handlers::unimplemented_handler(_request);
             }
+
+            if (_is_retryable && !response.get_failed())
+                state->get_dedup_cache().insert(entity_id, _request.transaction_id_, response.get_data());
         } else {
             if (data.contains("transaction_id") && data.at("transaction_id").is_string() && validator::is_uuid(
                     data.at("transaction_id").as_string().c_str())) {
-                _response->mark_as_failed(
+                response.mark_as_failed(
                     get_param_as_id(data, "transaction_id"),
                     "unprocessable entity", _timestamp, _validator.get_bag());
             } else {
-                _response->mark_as_failed(boost::uuids::uuid{}, "unprocessable entity", _timestamp,
-                                          _validator.get_bag());
+                response.mark_as_failed(boost::uuids::uuid{}, "unprocessable entity", _timestamp,
+                                        _validator.get_bag());
             }
         }
-        _response->mark_as_processed();
-
-        return _response;
+        response.mark_as_processed();
     }
 } // namespace aewt
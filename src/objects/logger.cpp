@@ -0,0 +1,71 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/logger.hpp>
+
+#include <aewt/config.hpp>
+
+#include <spdlog/async.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include <atomic>
+
+namespace aewt::logger {
+    /**
+     * Sampling
+     */
+    static std::atomic<std::size_t> sampling_ = 1;
+
+    void start(const config &config) {
+        spdlog::init_thread_pool(config.log_queue_size_, config.log_threads_);
+
+        const auto _logger = spdlog::create_async_nb<spdlog::sinks::stdout_color_sink_mt>("aewt");
+        spdlog::set_default_logger(_logger);
+
+        set_level(config.log_level_);
+        set_sampling(config.log_sampling_);
+    }
+
+    bool set_level(const std::string &level) {
+        const auto _level = spdlog::level::from_str(level);
+
+        // from_str resuelve a "off" cuando el nombre no es reconocido, solo se acepta si fue solicitado.
+        if (_level == spdlog::level::off && level != "off")
+            return false;
+
+        spdlog::set_level(_level);
+        return true;
+    }
+
+    void set_sampling(const std::size_t rate) {
+        sampling_.store(rate, std::memory_order_relaxed);
+    }
+
+    std::size_t get_sampling() {
+        return sampling_.load(std::memory_order_relaxed);
+    }
+
+    bool should_log() {
+        if (!spdlog::default_logger_raw()->should_log(spdlog::level::info))
+            return false;
+
+        const auto _rate = sampling_.load(std::memory_order_relaxed);
+        if (_rate <= 1)
+            return true;
+
+        thread_local std::size_t _counter = 0;
+        return ++_counter % _rate == 0;
+    }
+} // namespace aewt::logger
@@ -0,0 +1,171 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/loop_monitor.hpp>
+
+#include <aewt/config.hpp>
+#include <aewt/overload_detector.hpp>
+
+#include <pthread.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace aewt {
+    /**
+     * Thread Index
+     *
+     * Slot of the io thread running the current handler.
+     */
+    static thread_local std::size_t thread_index_ = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * Get Cpu Time
+     *
+     * @param clock
+     * @return nanoseconds
+     */
+    static std::chrono::nanoseconds get_cpu_time(const clockid_t clock) {
+        timespec _time{};
+        if (clock_gettime(clock, &_time) != 0)
+            return std::chrono::nanoseconds{0};
+
+        return std::chrono::seconds(_time.tv_sec) + std::chrono::nanoseconds(_time.tv_nsec);
+    }
+
+    loop_monitor::loop_monitor(boost::asio::io_context &ioc, const std::shared_ptr<config> &config,
+                               overload_detector &overload_detector)
+        : ioc_(ioc), config_(config), overload_detector_(overload_detector) {
+    }
+
+    bool loop_monitor::get_enabled() const {
+        return config_->monitor_interval_ > 0;
+    }
+
+    void loop_monitor::start(const std::size_t threads) {
+        if (!get_enabled())
+            return;
+
+        const auto _threads = std::max<std::size_t>(threads, 1);
+
+        slots_.reserve(_threads);
+        timers_.reserve(_threads);
+        for (std::size_t _i = 0; _i < _threads; ++_i) {
+            slots_.push_back(std::make_unique<slot>());
+            timers_.push_back(std::make_unique<boost::asio::steady_timer>(ioc_));
+        }
+
+        {
+            std::scoped_lock _lock(stats_mutex_);
+            stats_.assign(_threads, {});
+        }
+
+        sampled_at_ = std::chrono::steady_clock::now();
+
+        for (std::size_t _i = 0; _i < _threads; ++_i)
+            do_wait(_i);
+    }
+
+    void loop_monitor::run(const std::size_t index) {
+        if (index >= slots_.size()) {
+            ioc_.run();
+            return;
+        }
+
+        auto &_slot = *slots_[index];
+        thread_index_ = index;
+
+        pthread_getcpuclockid(pthread_self(), &_slot.clock_);
+        _slot.sampled_cpu_ = get_cpu_time(_slot.clock_);
+        _slot.running_.store(true, std::memory_order_release);
+
+        // run_one por iteración equivale a run y deja contar los handlers completados por el hilo
+        while (ioc_.run_one())
+            _slot.handlers_.fetch_add(1, std::memory_order_relaxed);
+
+        _slot.running_.store(false, std::memory_order_release);
+        thread_index_ = std::numeric_limits<std::size_t>::max();
+    }
+
+    void loop_monitor::do_wait(const std::size_t index) {
+        timers_[index]->expires_after(std::chrono::milliseconds(config_->monitor_interval_));
+        timers_[index]->async_wait(boost::beast::bind_front_handler(&loop_monitor::on_wait, this, index));
+    }
+
+    void loop_monitor::on_wait(const std::size_t index, const boost::beast::error_code &ec) {
+        if (ec)
+            return;
+
+        const auto _lag = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - timers_[index]->expiry()).count();
+
+        // El retraso se anota en el hilo que ejecutó el timer, no necesariamente el que lo armó
+        if (thread_index_ < slots_.size()) {
+            auto &_slot_lag = slots_[thread_index_]->lag_;
+            auto _current = _slot_lag.load(std::memory_order_relaxed);
+            while (_current < _lag && !_slot_lag.compare_exchange_weak(_current, _lag, std::memory_order_relaxed)) {
+            }
+        }
+
+        // Solo el primer timer muestrea, así las muestras nunca se solapan
+        if (index == 0)
+            sample();
+
+        do_wait(index);
+    }
+
+    void loop_monitor::sample() {
+        const auto _now = std::chrono::steady_clock::now();
+        const std::chrono::duration<double> _elapsed = _now - sampled_at_;
+        sampled_at_ = _now;
+
+        if (_elapsed.count() <= 0)
+            return;
+
+        std::vector<thread_stats> _stats(slots_.size());
+        std::chrono::microseconds _max_lag{0};
+
+        for (std::size_t _i = 0; _i < slots_.size(); ++_i) {
+            auto &_slot = *slots_[_i];
+            auto &_thread_stats = _stats[_i];
+
+            const auto _handlers = _slot.handlers_.load(std::memory_order_relaxed);
+            _thread_stats.handlers_per_second_ = static_cast<double>(_handlers - _slot.sampled_handlers_) / _elapsed.
+                                                 count();
+            _slot.sampled_handlers_ = _handlers;
+
+            _thread_stats.lag_ = std::chrono::microseconds(_slot.lag_.exchange(0, std::memory_order_relaxed));
+            _max_lag = std::max(_max_lag, _thread_stats.lag_);
+
+            if (!_slot.running_.load(std::memory_order_acquire))
+                continue;
+
+            const auto _cpu = get_cpu_time(_slot.clock_);
+            const std::chrono::duration<double> _busy = _cpu - _slot.sampled_cpu_;
+            _thread_stats.busy_ = std::clamp(_busy.count() / _elapsed.count(), 0.0, 1.0);
+            _slot.sampled_cpu_ = _cpu;
+        }
+
+        overload_detector_.set_lag(_max_lag);
+
+        std::scoped_lock _lock(stats_mutex_);
+        stats_.swap(_stats);
+    }
+
+    std::vector<loop_monitor::thread_stats> loop_monitor::get_stats() const {
+        std::scoped_lock _lock(stats_mutex_);
+        return stats_;
+    }
+} // namespace aewt
@@ -0,0 +1,152 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/message.hpp>
+
+#include <aewt/pool.hpp>
+
+#include <boost/json/serializer.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <memory_resource>
+#include <new>
+#include <string>
+
+namespace aewt {
+    struct message::block {
+        /**
+         * Count
+         */
+        std::atomic<std::size_t> count_;
+
+        /**
+         * Size
+         */
+        std::size_t size_;
+
+        /**
+         * Get Data
+         *
+         * @return char *
+         */
+        char *get_data() {
+            return reinterpret_cast<char *>(this + 1);
+        }
+    };
+
+    /**
+     * Get Message Resource
+     *
+     * @return memory_resource
+     */
+    static std::pmr::memory_resource *get_message_resource() {
+#if defined(OBJECT_POOLS_ENABLED)
+        return get_pool_resource();
+#else
+        return std::pmr::new_delete_resource();
+#endif
+    }
+
+    message::message(const std::string_view data) {
+        auto *_memory = get_message_resource()->allocate(sizeof(block) + data.size(), alignof(block));
+
+        block_ = ::new(_memory) block{1, data.size()};
+        if (!data.empty())
+            std::memcpy(block_->get_data(), data.data(), data.size());
+    }
+
+    message::message(const message &other) noexcept : block_(other.block_) {
+        if (block_ != nullptr)
+            block_->count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    message::message(message &&other) noexcept : block_(other.block_) {
+        other.block_ = nullptr;
+    }
+
+    message &message::operator=(const message &other) noexcept {
+        if (this != &other) {
+            if (other.block_ != nullptr)
+                other.block_->count_.fetch_add(1, std::memory_order_relaxed);
+            release();
+            block_ = other.block_;
+        }
+        return *this;
+    }
+
+    message &message::operator=(message &&other) noexcept {
+        if (this != &other) {
+            release();
+            block_ = other.block_;
+            other.block_ = nullptr;
+        }
+        return *this;
+    }
+
+    message::~message() {
+        release();
+    }
+
+    void message::release() noexcept {
+        if (block_ == nullptr)
+            return;
+
+        if (block_->count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            const auto _size = sizeof(block) + block_->size_;
+            block_->~block();
+            get_message_resource()->deallocate(block_, _size, alignof(block));
+        }
+
+        block_ = nullptr;
+    }
+
+    const char *message::get_data() const {
+        return block_ != nullptr ? block_->get_data() : nullptr;
+    }
+
+    std::size_t message::get_size() const {
+        return block_ != nullptr ? block_->size_ : 0;
+    }
+
+    std::string_view message::get_view() const {
+        return {get_data(), get_size()};
+    }
+
+    boost::asio::const_buffer message::get_buffer() const {
+        return {get_data(), get_size()};
+    }
+
+    std::size_t message::get_use_count() const {
+        return block_ != nullptr ? block_->count_.load(std::memory_order_relaxed) : 0;
+    }
+
+    message make_message(const boost::json::object &data) {
+        thread_local boost::json::serializer _serializer;
+        thread_local std::string _scratch;
+
+        // El buffer conserva su capacidad entre mensajes del mismo hilo
+        _scratch.clear();
+        _serializer.reset(&data);
+
+        char _chunk[4096];
+        while (!_serializer.done()) {
+            const auto _view = _serializer.read(_chunk, sizeof(_chunk));
+            _scratch.append(_view.data(), _view.size());
+        }
+
+        return message(_scratch);
+    }
+} // namespace aewt
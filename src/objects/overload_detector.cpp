@@ -0,0 +1,51 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/overload_detector.hpp>
+
+#include <aewt/config.hpp>
+
+namespace aewt {
+    overload_detector::overload_detector(const std::shared_ptr<config> &config) : config_(config) {
+    }
+
+    void overload_detector::on_enqueued(const std::size_t count) {
+        pending_.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    void overload_detector::on_dequeued(const std::size_t count) {
+        pending_.fetch_sub(count, std::memory_order_relaxed);
+    }
+
+    std::size_t overload_detector::get_pending() const {
+        return pending_.load(std::memory_order_relaxed);
+    }
+
+    void overload_detector::set_lag(const std::chrono::microseconds lag) {
+        lag_.store(lag.count(), std::memory_order_relaxed);
+    }
+
+    std::chrono::microseconds overload_detector::get_lag() const {
+        return std::chrono::microseconds(lag_.load(std::memory_order_relaxed));
+    }
+
+    bool overload_detector::get_overloaded() const {
+        if (const auto _limit = config_->overload_pending_; _limit > 0 && get_pending() > _limit)
+            return true;
+
+        const auto _lag = config_->overload_lag_;
+        return _lag > 0 && get_lag() > std::chrono::milliseconds(_lag);
+    }
+} // namespace aewt
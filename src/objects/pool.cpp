@@ -0,0 +1,24 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/pool.hpp>
+
+namespace aewt {
+    std::pmr::memory_resource *get_pool_resource() {
+        // Nunca se destruye, los objetos pueden liberarse mientras termina el proceso
+        static auto *_resource = new std::pmr::synchronized_pool_resource();
+        return _resource;
+    }
+} // namespace aewt
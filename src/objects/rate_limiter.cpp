@@ -0,0 +1,97 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/rate_limiter.hpp>
+
+#include <aewt/config.hpp>
+
+#include <algorithm>
+
+namespace aewt {
+    bool rate_limiter::bucket::try_take(const std::size_t rate, const std::size_t burst,
+                                        const std::chrono::steady_clock::time_point now) {
+        if (rate == 0)
+            return true;
+
+        const auto _capacity = static_cast<double>(std::max<std::size_t>(burst, 1));
+        const std::chrono::duration<double> _elapsed = now - updated_at_;
+
+        // Un bucket recién creado parte de la época del reloj y queda lleno
+        tokens_ = std::min(_capacity, tokens_ + _elapsed.count() * static_cast<double>(rate));
+        updated_at_ = now;
+
+        if (tokens_ < 1)
+            return false;
+
+        tokens_ -= 1;
+        return true;
+    }
+
+    rate_limiter::rate_limiter(const std::shared_ptr<config> &config) : config_(config) {
+    }
+
+    rate_limiter::shard &rate_limiter::get_shard(const boost::uuids::uuid entity_id) {
+        return shards_[entity_id.data[0] % shards_count];
+    }
+
+    bool rate_limiter::get_enabled() const {
+        return config_->client_rate_ > 0 || config_->fanout_rate_ > 0;
+    }
+
+    bool rate_limiter::try_acquire(const boost::uuids::uuid entity_id, const bool fanout) {
+        if (!get_enabled())
+            return true;
+
+        const auto _now = std::chrono::steady_clock::now();
+        auto &_shard = get_shard(entity_id);
+
+        std::scoped_lock _lock(_shard.mutex_);
+
+        auto &_buckets = _shard.entries_[entity_id];
+
+        // El token de fan-out solo se descuenta si el bucket general también lo permite
+        if (fanout && config_->fanout_rate_ > 0) {
+            auto _fanout = _buckets.fanout_;
+            if (!_fanout.try_take(config_->fanout_rate_, config_->fanout_burst_, _now))
+                return false;
+
+            if (!_buckets.requests_.try_take(config_->client_rate_, config_->client_burst_, _now))
+                return false;
+
+            _buckets.fanout_ = _fanout;
+            return true;
+        }
+
+        return _buckets.requests_.try_take(config_->client_rate_, config_->client_burst_, _now);
+    }
+
+    void rate_limiter::remove(const boost::uuids::uuid entity_id) {
+        auto &_shard = get_shard(entity_id);
+
+        std::scoped_lock _lock(_shard.mutex_);
+        _shard.entries_.erase(entity_id);
+    }
+
+    std::size_t rate_limiter::get_size() {
+        std::size_t _size = 0;
+
+        for (auto &_shard: shards_) {
+            std::scoped_lock _lock(_shard.mutex_);
+            _size += _shard.entries_.size();
+        }
+
+        return _size;
+    }
+} // namespace aewt
@@ -0,0 +1,47 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/reconciler.hpp>
+
+#include <boost/asio/strand.hpp>
+
+#include <aewt/logger.hpp>
+#include <aewt/state.hpp>
+
+namespace aewt {
+    reconciler::reconciler(boost::asio::io_context &ioc, const std::shared_ptr<state> &state)
+        : state_(state), timer_(make_strand(ioc)) {
+    }
+
+    void reconciler::start() {
+        do_wait();
+    }
+
+    void reconciler::do_wait() {
+        timer_.expires_after(std::chrono::seconds(state_->get_config()->anti_entropy_interval_));
+        timer_.async_wait(boost::beast::bind_front_handler(&reconciler::on_wait, shared_from_this()));
+    }
+
+    void reconciler::on_wait(const boost::beast::error_code &ec) {
+        if (ec)
+            return;
+
+        const auto _sessions = state_->digest_to_sessions();
+
+        LOG_INFO("state_id=[{}] action=[digest] sessions=[{}]", state_->get_id(), _sessions);
+
+        do_wait();
+    }
+} // namespace aewt
@@ -17,6 +17,7 @@
 
 #include <aewt/session.hpp>
 #include <aewt/state.hpp>
+#include <aewt/logger.hpp>
 
 #include <boost/asio/posix/stream_descriptor.hpp>
 #include <boost/asio/streambuf.hpp>
@@ -72,6 +73,16 @@ namespace aewt {
                 }
                 fmt::print("============\n");
 
+                const auto _remote_clients = state_->get_remote_clients();
+
+                fmt::print("remote clients {}\n", _remote_clients.size());
+                fmt::print("============\n");
+
+                for (auto & _client : _remote_clients) {
+                    fmt::print("id {} session_id={}\n\n", to_string(_client.id_), to_string(_client.session_id_));
+                }
+                fmt::print("============\n");
+
                 const auto _subscriptions = state_->get_subscriptions();
 
 
@@ -81,6 +92,51 @@ namespace aewt {
                     fmt::print("client_id={} session_id={} channel={}\n\n", to_string(_subscription.client_id_), to_string(_subscription.session_id_), _subscription.channel_);
                 }
                 fmt::print("============\n");
+
+                const auto _interests = state_->get_interests();
+
+                fmt::print("interests {}\n", _interests.size());
+                fmt::print("============\n");
+                for (auto & _interest : _interests) {
+                    fmt::print("session_id={} channel={} count={}\n\n", to_string(_interest.session_id_), _interest.channel_, _interest.count_);
+                }
+                fmt::print("============\n");
+            }
+
+            if (_line == "stats") {
+                const auto &_overload_detector = state_->get_overload_detector();
+                const auto _stats = state_->get_loop_monitor().get_stats();
+
+                fmt::print("threads {}\n", _stats.size());
+                fmt::print("============\n");
+
+                for (std::size_t _i = 0; _i < _stats.size(); ++_i) {
+                    fmt::print("thread #{} lag_us={} handlers_per_second={:.0f} busy={:.1f}%\n", _i,
+                               _stats[_i].lag_.count(), _stats[_i].handlers_per_second_, _stats[_i].busy_ * 100);
+                }
+                fmt::print("============\n");
+
+                fmt::print("pending={} lag_us={} overloaded={}\n", _overload_detector.get_pending(),
+                           _overload_detector.get_lag().count(), _overload_detector.get_overloaded());
+            }
+
+            if (_line.starts_with("log_level ")) {
+                const auto _level = _line.substr(10);
+
+                if (logger::set_level(_level)) {
+                    fmt::print("log_level={}\n", _level);
+                } else {
+                    fmt::print("unknown log level {}\n", _level);
+                }
+            }
+
+            if (_line.starts_with("log_sampling ")) {
+                try {
+                    logger::set_sampling(std::stoul(_line.substr(13)));
+                    fmt::print("log_sampling={}\n", logger::get_sampling());
+                } catch (const std::exception &) {
+                    fmt::print("log_sampling expects a number\n");
+                }
             }
 
             if (_line == "exit") {
@@ -20,26 +20,26 @@
 
 namespace aewt {
     bool response::get_failed() const {
-        return failed_.load(std::memory_order_acquire);
+        return failed_;
     }
 
     bool response::get_processed() const {
-        return processed_.load(std::memory_order_acquire);
+        return processed_;
     }
 
     bool response::is_ack() const {
-        return is_ack_.load(std::memory_order_acquire);
+        return is_ack_;
     }
 
     void response::mark_as_ack() {
-        is_ack_.store(true, std::memory_order_release);
+        is_ack_ = true;
     }
 
-    boost::json::object response::get_data() const { return data_; }
+    const boost::json::object &response::get_data() const { return data_; }
 
     void response::mark_as_failed(const boost::uuids::uuid transaction_id, const char *error, long timestamp,
                                   const std::map<std::string, std::string> &bag) {
-        failed_.store(true, std::memory_order_release);
+        failed_ = true;
         const auto _current_timestamp = std::chrono::system_clock::now().time_since_epoch().count();
 
         const auto _runtime = _current_timestamp - timestamp;
@@ -73,8 +73,12 @@ namespace aewt {
         }
     }
 
+    void response::set_data(const boost::json::object &data) {
+        data_ = data;
+    }
+
     void response::mark_as_processed() {
-        processed_.store(true, std::memory_order_release);
+        processed_ = true;
     }
 
 
@@ -19,10 +19,13 @@
 #include <aewt/session.hpp>
 
 #include <aewt/logger.hpp>
+#include <aewt/pool.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
 #include <aewt/session_listener.hpp>
 #include <aewt/client_listener.hpp>
+#include <aewt/reconciler.hpp>
+#include <aewt/drainer.hpp>
 #include <aewt/repl.hpp>
 #include <boost/asio/strand.hpp>
 
@@ -36,18 +39,18 @@ namespace aewt {
         auto const _address = boost::asio::ip::make_address(_config->address_);
         boost::asio::ip::tcp::resolver _resolver{make_strand(state_->get_ioc())};
 
-        LOG_INFO("state_id=[{}] action=[running] sessions_port=[{}] clients_port=[{}]", to_string(state_->get_id()),
+        LOG_INFO("state_id=[{}] action=[running] sessions_port=[{}] clients_port=[{}]", state_->get_id(),
                  _config->sessions_port_.load(std::memory_order_acquire), _config->clients_port_.load(std::memory_order_acquire));
 
         if (_config->is_node_) {
-            LOG_INFO("state_id=[{}] action=[waiting for remote] remote_address=[{}] remote_sessions_port=[{}]", to_string(state_->get_id()),
+            LOG_INFO("state_id=[{}] action=[waiting for remote] remote_address=[{}] remote_sessions_port=[{}]", state_->get_id(),
                      _config->remote_address_, _config->remote_sessions_port_.load(std::memory_order_acquire));
 
             std::this_thread::sleep_for(std::chrono::seconds(3));
 
             auto const _results = _resolver.resolve(_config->remote_address_,
                                                     std::to_string(_config->remote_sessions_port_.load(std::memory_order_acquire)));
-            const auto _remote_session = std::make_shared<session>(
+            const auto _remote_session = make_pooled<session>(
                 state_, boost::asio::ip::tcp::socket{make_strand(state_->get_ioc())});
             auto &_socket = _remote_session->get_socket();
             auto &_lowest_socket = _socket.next_layer().socket().lowest_layer();
@@ -85,17 +88,24 @@ namespace aewt {
 
         client_listener_->start();
 
+        if (_config->anti_entropy_interval_ > 0) {
+            reconciler_ = std::make_shared<reconciler>(state_->get_ioc(), state_);
+            reconciler_->start();
+        }
+
         if (_config->repl_enabled) {
             repl_ = std::make_unique<repl>(state_);
         }
 
+        state_->get_loop_monitor().start(config_->threads_);
+
         vector_of_threads_.reserve(config_->threads_ - 1);
         for (auto i = config_->threads_ - 1; i > 0; --i)
             vector_of_threads_.emplace_back(
-                [_state = this->state_->shared_from_this()]() {
-                    _state->get_ioc().run();
+                [_state = this->state_->shared_from_this(), i]() {
+                    _state->get_loop_monitor().run(i);
                 });
-        state_->get_ioc().run();
+        state_->get_loop_monitor().run(0);
     }
 
     std::shared_ptr<config> server::get_config() {
@@ -107,6 +117,11 @@ namespace aewt {
     }
 
     void server::stop() const {
-        state_->get_ioc().stop();
+        if (config_->drain_timeout_ == 0) {
+            state_->get_ioc().stop();
+            return;
+        }
+
+        std::make_shared<drainer>(state_->get_ioc(), state_, session_listener_, client_listener_)->start();
     }
 } // namespace aewt
@@ -19,7 +19,9 @@
 #include <aewt/kernel.hpp>
 
 #include <aewt/logger.hpp>
+#include <aewt/message.hpp>
 #include <aewt/response.hpp>
+#include <aewt/deflate.hpp>
 #include <boost/core/ignore_unused.hpp>
 
 #include <boost/uuid/uuid_io.hpp>
@@ -31,13 +33,15 @@ namespace aewt {
     session::session(const std::shared_ptr<state> &state,
                      boost::asio::ip::tcp::socket &&socket, const boost::uuids::uuid id)
         : state_(state), id_(id), socket_(boost::beast::tcp_stream(std::move(socket))) {
-        LOG_INFO("state_id=[{}] action=[session_allocated] session_id=[{}]", to_string(state_->get_id()),
-                 to_string(id_));
+        LOG_INFO("state_id=[{}] action=[session_allocated] session_id=[{}]", state_->get_id(),
+                 id_);
     }
 
     session::~session() {
-        LOG_INFO("state_id=[{}] action=[session_released] session_id=[{}]", to_string(state_->get_id()),
-                 to_string(id_));
+        state_->get_overload_detector().on_dequeued(queue_.size());
+
+        LOG_INFO("state_id=[{}] action=[session_released] session_id=[{}]", state_->get_id(),
+                 id_);
 
         state_->remove_state_of_session(id_);
     }
@@ -46,7 +50,7 @@ namespace aewt {
 
     boost::beast::websocket::stream<boost::beast::tcp_stream> &session::get_socket() { return socket_; }
 
-    void session::send(std::shared_ptr<std::string const> const &data) {
+    void session::send(message const &data) {
         boost::ignore_unused(data);
 
         if (socket_.is_open()) {
@@ -54,6 +58,10 @@ namespace aewt {
         }
     }
 
+    void session::close() {
+        post(socket_.get_executor(), boost::beast::bind_front_handler(&session::do_close, shared_from_this()));
+    }
+
     void session::run(session_context context) {
         dispatch(socket_.get_executor(),
                  boost::beast::bind_front_handler(&session::on_run, shared_from_this(), context));
@@ -92,6 +100,9 @@ namespace aewt {
     }
 
     void session::on_run(const session_context context) {
+        const auto &_config = state_->get_config();
+        socket_.set_option(get_deflate_options(*_config, _config->deflate_sessions_));
+
         switch (context) {
             case local: {
                 socket_.async_accept(
@@ -137,7 +148,7 @@ namespace aewt {
             // Para evitar que las siguientes conexiones remitan el listado de sesiones se marca una bandera
             _config->registered_.store(true, std::memory_order_release);
 
-            send(std::make_shared<std::string const>(serialize(_response)));
+            send(make_message(_response));
         }
 
         do_read();
@@ -166,8 +177,11 @@ namespace aewt {
         boost::system::error_code _parse_ec;
 
         if (auto _data = boost::json::parse(_stream, _parse_ec); !_parse_ec && _data.is_object()) {
-            if (const auto _response = kernel(state_, _data.as_object(), on_session, get_id()); !_response->is_ack()) {
-                send(std::make_shared<std::string const>(serialize(_response->get_data())));
+            response _response;
+            kernel(state_, _data.as_object(), on_session, get_id(), _response);
+
+            if (!_response.is_ack()) {
+                send(make_message(_response.get_data()));
             }
         } else {
             auto _now = std::chrono::system_clock::now().time_since_epoch().count();
@@ -183,7 +197,7 @@ namespace aewt {
                 {"timestamp", _now},
                 {"runtime", _now - _read_at},
             };
-            send(std::make_shared<std::string const>(serialize(_response)));
+            send(make_message(_response));
         }
 
         buffer_.consume(buffer_.size());
@@ -191,15 +205,17 @@ namespace aewt {
         do_read();
     }
 
-    void session::on_send(std::shared_ptr<std::string const> const &data) {
+    void session::on_send(message const &data) {
+        if (closing_)
+            return;
+
         queue_.push_back(data);
+        state_->get_overload_detector().on_enqueued();
 
         if (queue_.size() > 1)
             return;
 
-        const auto _message = *queue_.begin();
-
-        socket_.async_write(boost::asio::buffer(*queue_.front()),
+        socket_.async_write(queue_.front().get_buffer(),
                             boost::beast::bind_front_handler(&session::on_write, shared_from_this()));
     }
 
@@ -208,12 +224,27 @@ namespace aewt {
             return;
 
         queue_.erase(queue_.begin());
+        state_->get_overload_detector().on_dequeued();
 
         if (!queue_.empty())
             socket_.async_write(
-                boost::asio::buffer(*queue_.front()),
+                queue_.front().get_buffer(),
                 boost::beast::bind_front_handler(
                     &session::on_write,
                     shared_from_this()));
     }
+
+    void session::do_close() {
+        if (closing_ || !socket_.is_open())
+            return;
+
+        closing_ = true;
+        socket_.async_close(boost::beast::websocket::close_code::going_away,
+                            boost::beast::bind_front_handler(&session::on_close, shared_from_this()));
+    }
+
+    void session::on_close(const boost::beast::error_code &ec) {
+        LOG_INFO("state_id=[{}] action=[session_closed] session_id=[{}] status=[{}]", state_->get_id(), id_,
+                 ec ? ec.message() : "ok");
+    }
 } // namespace aewt
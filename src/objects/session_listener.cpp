@@ -18,6 +18,7 @@
 #include <boost/asio/strand.hpp>
 
 #include <aewt/logger.hpp>
+#include <aewt/pool.hpp>
 #include <aewt/session.hpp>
 #include <aewt/state.hpp>
 #include <boost/uuid/uuid_io.hpp>
@@ -53,15 +54,19 @@ namespace aewt {
         }
 
         state_->get_config()->sessions_port_.store(acceptor_.local_endpoint().port(), std::memory_order_release);
-        LOG_INFO("state_id=[{}] sessions is listening on [{}]", to_string(state_->get_id()),
+        LOG_INFO("state_id=[{}] sessions is listening on [{}]", state_->get_id(),
                  state_->get_config()->sessions_port_.load(std::memory_order_acquire));
     }
 
     void session_listener::on_accept(const boost::beast::error_code &ec, boost::asio::ip::tcp::socket socket) {
         if (ec) {
             LOG_INFO("listener failed on accept: {}", ec.what());
+
+            // Un acceptor cerrado por el drenado no vuelve a aceptar
+            if (!acceptor_.is_open())
+                return;
         } else {
-            const auto _session = std::make_shared<session>(state_, std::move(socket));
+            const auto _session = make_pooled<session>(state_, std::move(socket));
             state_->add_session(_session);
             _session->run(local);
         }
@@ -80,4 +85,11 @@ namespace aewt {
     void session_listener::start() {
         do_accept();
     }
+
+    void session_listener::stop() {
+        post(acceptor_.get_executor(), [_self = shared_from_this()] {
+            boost::beast::error_code _ec;
+            _self->acceptor_.close(_ec);
+        });
+    }
 } // namespace aewt
@@ -17,12 +17,14 @@
 #include <aewt/session.hpp>
 #include <aewt/state.hpp>
 #include <aewt/logger.hpp>
+#include <aewt/message.hpp>
 #include <aewt/subscription.hpp>
 #include <aewt/request.hpp>
 
 #include <boost/uuid/random_generator.hpp>
 #include <boost/json/serialize.hpp>
 #include <boost/uuid/uuid_io.hpp>
+#include <algorithm>
 #include <ranges>
 #include <unordered_set>
 
@@ -30,12 +32,14 @@
 
 namespace aewt {
     state::state(const std::shared_ptr<config> &config)
-        : config_(config), id_(boost::uuids::random_generator()()), created_at_(std::chrono::system_clock::now()) {
-        LOG_INFO("state_id=[{}] action=[state_allocated]", to_string(id_));
+        : config_(config ? config : std::make_shared<aewt::config>()), id_(boost::uuids::random_generator()()), created_at_(std::chrono::system_clock::now()),
+          dedup_cache_(config_), history_(config_), rate_limiter_(config_), overload_detector_(config_),
+          loop_monitor_(ioc_, config_, overload_detector_) {
+        LOG_INFO("state_id=[{}] action=[state_allocated]", id_);
     }
 
     state::~state() {
-        LOG_INFO("state_id=[{}] action=[state_released]", to_string(id_));
+        LOG_INFO("state_id=[{}] action=[state_released]", id_);
     }
 
     boost::uuids::uuid state::get_id() const { return id_; }
@@ -69,6 +73,32 @@ namespace aewt {
         return _result;
     }
 
+    std::vector<remote_client> state::get_remote_clients() const {
+        std::shared_lock _lock(clients_mutex_);
+
+        const auto &_index = remote_clients_.get<remote_clients_by_client>();
+
+        return {_index.begin(), _index.end()};
+    }
+
+    bool state::get_client_exists(const boost::uuids::uuid client_id) const {
+        return get_client_session(client_id).has_value();
+    }
+
+    std::optional<boost::uuids::uuid> state::get_client_session(const boost::uuids::uuid client_id) const {
+        std::shared_lock _lock(clients_mutex_);
+
+        const auto &_clients = clients_.get<clients_by_client>();
+        if (const auto _iterator = _clients.find(client_id); _iterator != _clients.end())
+            return (*_iterator)->get_session_id();
+
+        const auto &_remote_clients = remote_clients_.get<remote_clients_by_client>();
+        if (const auto _iterator = _remote_clients.find(client_id); _iterator != _remote_clients.end())
+            return _iterator->session_id_;
+
+        return std::nullopt;
+    }
+
     std::vector<subscription> state::get_subscriptions() const {
         std::shared_lock _lock(subscriptions_mutex_);
 
@@ -130,26 +160,88 @@ namespace aewt {
     }
 
     bool state::remove_client(const boost::uuids::uuid client_id) {
+        std::size_t _count = 0; {
+            std::unique_lock _lock(clients_mutex_);
+
+            auto &_index = clients_.get<clients_by_client>();
+            auto [_begin, _end] = _index.equal_range(client_id);
+
+            _count = std::distance(_begin, _end);
+            _index.erase(_begin, _end);
+            _count += remote_clients_.get<remote_clients_by_client>().erase(client_id);
+        }
+
+        remove_subscriptions_of_client(client_id);
+        rate_limiter_.remove(client_id);
+
+        return _count > 0;
+    }
+
+    std::size_t state::remove_subscriptions_of_client(const boost::uuids::uuid client_id) {
+        std::unique_lock _lock(subscriptions_mutex_);
+
+        auto &_index = subscriptions_.get<subscriptions_by_client>();
+        auto [_it, _end] = _index.equal_range(client_id);
+
+        std::size_t _removed = 0;
+        std::vector<std::string> _channels;
+
+        while (_it != _end) {
+            const auto _session_id = _it->session_id_;
+            const auto _channel = _it->channel_;
+
+            _it = _index.erase(_it);
+            ++_removed;
+
+            if (decrement_interest(_session_id, _channel) == 0)
+                _channels.push_back(_channel);
+        }
+
+        if (!_channels.empty())
+            interest_to_sessions({}, _channels);
+
+        return _removed;
+    }
+
+    void state::park_client(const boost::uuids::uuid token, const std::shared_ptr<client> &client) {
         std::unique_lock _lock(clients_mutex_);
+        parked_clients_.insert_or_assign(token, client);
+    }
 
-        auto &_index = clients_.get<clients_by_client>();
-        auto [_begin, _end] = _index.equal_range(client_id);
+    std::optional<std::shared_ptr<client> > state::take_parked_client(const boost::uuids::uuid token) {
+        std::unique_lock _lock(clients_mutex_);
+
+        const auto _iterator = parked_clients_.find(token);
+        if (_iterator == parked_clients_.end())
+            return std::nullopt;
+
+        auto _client = std::move(_iterator->second);
+        parked_clients_.erase(_iterator);
 
-        const std::size_t _count = std::distance(_begin, _end);
-        _index.erase(_begin, _end);
-        return _count;
+        return _client;
     }
 
     bool state::subscribe(const boost::uuids::uuid &session_id, const boost::uuids::uuid &client_id,
                           const std::string &channel) {
         std::unique_lock _lock(subscriptions_mutex_);
 
+        // Los clientes remotos no generan filas, solo incrementan el contador del canal en su sesión.
+        if (session_id != id_) {
+            increment_interest(session_id, channel);
+            return true;
+        }
+
         auto &_index =
                 subscriptions_.get<subscriptions_by_session_client_channel>();
 
         auto [_it, _inserted] =
                 _index.insert(subscription{session_id, client_id, channel});
 
+        // Se notifica mientras se retiene el bloqueo de suscripciones para que las altas y bajas de un mismo
+        // canal lleguen a los pares en el orden en que ocurrieron.
+        if (_inserted && increment_interest(session_id, channel) == 1)
+            interest_to_sessions({channel}, {});
+
         return _inserted;
     }
 
@@ -157,6 +249,9 @@ namespace aewt {
                             const std::string &channel) {
         std::unique_lock _lock(subscriptions_mutex_);
 
+        if (session_id != id_)
+            return decrement_interest(session_id, channel).has_value();
+
         auto &_index =
                 subscriptions_.get<subscriptions_by_session_client_channel>();
 
@@ -168,17 +263,126 @@ namespace aewt {
             return false;
 
         _index.erase(_iterator);
+
+        if (decrement_interest(session_id, channel) == 0)
+            interest_to_sessions({}, {channel});
+
         return true;
     }
 
+    std::vector<bool> state::subscribe_many(const boost::uuids::uuid &session_id, const boost::uuids::uuid &client_id,
+                                            const std::vector<std::string> &channels) {
+        std::vector<bool> _result;
+        _result.reserve(channels.size());
+
+        std::unique_lock _lock(subscriptions_mutex_);
+
+        if (session_id != id_) {
+            for (const auto &_channel: channels) {
+                increment_interest(session_id, _channel);
+                _result.push_back(true);
+            }
+            return _result;
+        }
+
+        auto &_index =
+                subscriptions_.get<subscriptions_by_session_client_channel>();
+
+        std::vector<std::string> _add;
+
+        for (const auto &_channel: channels) {
+            auto [_it, _inserted] =
+                    _index.insert(subscription{session_id, client_id, _channel});
+
+            if (_inserted && increment_interest(session_id, _channel) == 1)
+                _add.push_back(_channel);
+
+            _result.push_back(_inserted);
+        }
+
+        if (!_add.empty())
+            interest_to_sessions(_add, {});
+
+        return _result;
+    }
+
+    std::vector<bool> state::unsubscribe_many(const boost::uuids::uuid &session_id,
+                                              const boost::uuids::uuid &client_id,
+                                              const std::vector<std::string> &channels) {
+        std::vector<bool> _result;
+        _result.reserve(channels.size());
+
+        std::unique_lock _lock(subscriptions_mutex_);
+
+        if (session_id != id_) {
+            for (const auto &_channel: channels)
+                _result.push_back(decrement_interest(session_id, _channel).has_value());
+            return _result;
+        }
+
+        auto &_index =
+                subscriptions_.get<subscriptions_by_session_client_channel>();
+
+        std::vector<std::string> _remove;
+
+        for (const auto &_channel: channels) {
+            const auto _iterator = _index.find(
+                boost::make_tuple(session_id, client_id, _channel)
+            );
+
+            if (_iterator == _index.end()) {
+                _result.push_back(false);
+                continue;
+            }
+
+            _index.erase(_iterator);
+
+            if (decrement_interest(session_id, _channel) == 0)
+                _remove.push_back(_channel);
+
+            _result.push_back(true);
+        }
+
+        if (!_remove.empty())
+            interest_to_sessions({}, _remove);
+
+        return _result;
+    }
+
     bool state::is_subscribed(const boost::uuids::uuid &client_id,
                               const std::string &channel) {
-        std::shared_lock _lock(subscriptions_mutex_);
+        {
+            std::shared_lock _lock(subscriptions_mutex_);
+
+            const auto &_idx = subscriptions_.get<subscriptions_by_client_channel>();
+
+            if (_idx.find(std::make_tuple(client_id, channel)) != _idx.end())
+                return true;
+
+            const auto &_client_index = subscriptions_.get<subscriptions_by_client>();
 
+            for (auto [_it, _end] = _client_index.equal_range(client_id); _it != _end; ++_it) {
+                if (channel_trie::is_pattern(_it->channel_) && channel_trie::matches(_it->channel_, channel))
+                    return true;
+            }
+        }
+
+        // Para un cliente remoto solo se conoce si su sesión tiene suscriptores en el canal.
+        const auto _session_id = get_client_session(client_id);
+        if (!_session_id.has_value() || _session_id.value() == id_)
+            return false;
 
-        const auto &_idx = subscriptions_.get<subscriptions_by_client_channel>();
+        std::shared_lock _lock(interests_mutex_);
 
-        return _idx.find(std::make_tuple(client_id, channel)) != _idx.end();
+        const auto &_index = interests_.get<interests_by_session_channel>();
+
+        if (_index.find(boost::make_tuple(_session_id.value(), channel)) != _index.end())
+            return true;
+
+        std::vector<boost::uuids::uuid> _matched;
+        patterns_.match(channel, _matched);
+
+        return std::ranges::find(_matched, _session_id.value()) != _matched.end();
     }
 
     std::size_t state::broadcast_to_sessions(const request &request,
@@ -191,21 +395,27 @@ namespace aewt {
 
     std::size_t state::broadcast_to_clients(const request &request, const boost::uuids::uuid session_id,
                                             const boost::uuids::uuid client_id, const boost::json::object &data) const {
-        const auto _data = std::make_shared<boost::json::object>(
-            make_broadcast_request_object(request, client_id, data)
-        );
+        const auto _data = make_message(make_broadcast_request_object(request, client_id, data));
 
         return send_to_others_clients(_data, session_id, client_id);
     }
 
     std::size_t state::send_to_subscribed_sessions(const boost::json::object &data, const std::string &channel) const {
         std::unordered_set<boost::uuids::uuid> _receivers; {
-            std::shared_lock _lock(subscriptions_mutex_);
-            const auto &_idx = subscriptions_.get<subscriptions_by_channel>();
+            std::shared_lock _lock(interests_mutex_);
+            const auto &_idx = interests_.get<interests_by_channel>();
             for (auto [_it, _end] = _idx.equal_range(channel); _it != _end; ++_it) {
-                if (const auto _subscription = *_it; !_receivers.contains(_subscription.session_id_)) {
-                    _receivers.insert(_subscription.session_id_);
-                }
+                if (_it->session_id_ != id_)
+                    _receivers.insert(_it->session_id_);
+            }
+
+            // Los patrones se resuelven en el trie, el costo depende de la profundidad del canal y no de su cantidad
+            std::vector<boost::uuids::uuid> _matched;
+            patterns_.match(channel, _matched);
+
+            for (const auto &_session_id: _matched) {
+                if (_session_id != id_)
+                    _receivers.insert(_session_id);
             }
         }
 
@@ -214,7 +424,7 @@ namespace aewt {
         }
 
         auto _sessions = get_sessions();
-        auto const _message = std::make_shared<std::string const>(serialize(data));
+        auto const _message = make_message(data);
 
         for (const auto &_session: _sessions) {
             if (_receivers.contains(_session->get_id()))
@@ -235,28 +445,48 @@ namespace aewt {
     std::size_t state::publish_to_clients(const request &request, const boost::uuids::uuid session_id,
                                           const boost::uuids::uuid client_id, const std::string &channel,
                                           const boost::json::object &data) const {
-        const auto _data = std::make_shared<boost::json::object>(
-            make_publish_request_object(request, client_id, channel, data)
-        );
+        auto _data = make_publish_request_object(request, client_id, channel, data);
 
-        return send_to_others_clients(_data, session_id, client_id);
+        if (!history_.get_enabled())
+            return send_to_others_clients(make_message(_data), session_id, client_id);
+
+        // La secuencia viaja en la publicación para que el cliente sepa desde dónde retomar
+        const auto _sequence = history_.next_sequence();
+        _data["params"].as_object()["sequence"] = _sequence;
+
+        const auto _message = make_message(_data);
+        history_.push(channel, _sequence, _message);
+
+        return send_to_others_clients(_message, session_id, client_id);
     }
 
     std::size_t state::join_to_sessions(const boost::uuids::uuid client_id) const {
+        // Los pares ya olvidaron a un estado que se drena, anunciar cambios solo volvería a registrarlo
+        if (get_draining())
+            return 0;
+
         const auto _data = make_join_request_object(client_id);
 
         return send_to_sessions(_data);
     }
 
     std::size_t state::leave_to_sessions(const boost::uuids::uuid client_id) const {
+        if (get_draining())
+            return 0;
+
         const auto _data = make_leave_request_object(client_id);
 
         return send_to_sessions(_data);
     }
 
-    std::size_t state::subscribe_to_sessions(const request &request,
-                                             const boost::uuids::uuid client_id, const std::string &channel) const {
-        const auto _data = make_subscribe_request_object(request, client_id, channel);
+    std::size_t state::interest_to_sessions(const std::vector<std::string> &add,
+                                            const std::vector<std::string> &remove) const {
+        if (get_draining())
+            return 0;
+
+        const auto _data = make_interest_request_object(
+            boost::json::array(add.begin(), add.end()),
+            boost::json::array(remove.begin(), remove.end()));
 
         return send_to_sessions(_data);
     }
@@ -271,6 +501,112 @@ namespace aewt {
         return _inserted;
     }
 
+    bool state::push_remote_client(const remote_client &client) {
+        std::unique_lock _lock(clients_mutex_);
+
+        return remote_clients_.insert(client).second;
+    }
+
+    std::size_t state::push_remote_clients(const std::vector<remote_client> &clients) {
+        std::unique_lock _lock(clients_mutex_);
+
+        std::size_t _inserted = 0;
+        for (const auto &_client: clients) {
+            if (remote_clients_.insert(_client).second)
+                ++_inserted;
+        }
+
+        return _inserted;
+    }
+
+    std::vector<interest> state::get_interests() const {
+        std::shared_lock _lock(interests_mutex_);
+
+        const auto &_index = interests_.get<interests_by_session>();
+
+        return {_index.begin(), _index.end()};
+    }
+
+    std::size_t state::increment_interest(const boost::uuids::uuid &session_id, const std::string &channel) {
+        std::unique_lock _lock(interests_mutex_);
+
+        auto &_index = interests_.get<interests_by_session_channel>();
+
+        const auto _iterator = _index.find(boost::make_tuple(session_id, channel));
+        if (_iterator == _index.end()) {
+            _index.insert(interest{session_id, channel, 1});
+
+            if (channel_trie::is_pattern(channel))
+                patterns_.insert(channel, session_id);
+
+            return 1;
+        }
+
+        _index.modify(_iterator, [](interest &entry) { ++entry.count_; });
+        return _iterator->count_;
+    }
+
+    std::optional<std::size_t> state::decrement_interest(const boost::uuids::uuid &session_id,
+                                                         const std::string &channel) {
+        std::unique_lock _lock(interests_mutex_);
+
+        auto &_index = interests_.get<interests_by_session_channel>();
+
+        const auto _iterator = _index.find(boost::make_tuple(session_id, channel));
+        if (_iterator == _index.end())
+            return std::nullopt;
+
+        if (_iterator->count_ <= 1) {
+            _index.erase(_iterator);
+
+            if (channel_trie::is_pattern(channel))
+                patterns_.erase(channel, session_id);
+
+            return 0;
+        }
+
+        _index.modify(_iterator, [](interest &entry) { --entry.count_; });
+        return _iterator->count_;
+    }
+
+    std::size_t state::push_interests(const boost::uuids::uuid &session_id, const std::vector<std::string> &channels) {
+        std::unique_lock _lock(interests_mutex_);
+
+        auto &_index = interests_.get<interests_by_session_channel>();
+
+        std::size_t _inserted = 0;
+        for (const auto &_channel: channels) {
+            if (_index.insert(interest{session_id, _channel}).second) {
+                if (channel_trie::is_pattern(_channel))
+                    patterns_.insert(_channel, session_id);
+
+                ++_inserted;
+            }
+        }
+
+        return _inserted;
+    }
+
+    std::size_t state::pull_interests(const boost::uuids::uuid &session_id, const std::vector<std::string> &channels) {
+        std::unique_lock _lock(interests_mutex_);
+
+        auto &_index = interests_.get<interests_by_session_channel>();
+
+        std::size_t _removed = 0;
+        for (const auto &_channel: channels) {
+            if (const auto _iterator = _index.find(boost::make_tuple(session_id, _channel)); _iterator != _index.end()) {
+                _index.erase(_iterator);
+
+                if (channel_trie::is_pattern(_channel))
+                    patterns_.erase(_channel, session_id);
+
+                ++_removed;
+            }
+        }
+
+        return _removed;
+    }
+
     void state::sync(const std::shared_ptr<session> &session, const bool registered) {
         if (!registered) {
             for (const auto &_session: get_sessions()) {
@@ -301,70 +637,180 @@ namespace aewt {
                     }
                 };
 
-                auto const _message = std::make_shared<std::string const>(serialize(_data));
+                auto const _message = make_message(_data);
                 session->send(_message);
             }
-        } {
+        }
+
+        // Se toma una copia de los clientes e intereses locales para no retener los bloqueos mientras se
+        // serializan los lotes.
+        std::vector<boost::uuids::uuid> _clients; {
             std::shared_lock _lock(clients_mutex_);
 
             const auto &_index = clients_.get<clients_by_session>();
 
-            for (auto [_it, _end] = _index.equal_range(get_id()); _it != _end; ++_it) {
-                const auto _client = *_it;
+            for (auto [_it, _end] = _index.equal_range(get_id()); _it != _end; ++_it)
+                _clients.push_back((*_it)->get_id());
+        }
 
-                boost::json::object _data = {
-                    {"action", "join"},
-                    {"transaction_id", to_string(boost::uuids::random_generator()())},
-                    {
-                        "params", {
-                            {"client_id", to_string(_client->get_id())},
-                        }
-                    }
-                };
+        send_sync(session, _clients, get_interest_channels(get_id()));
+    }
 
-                auto const _message = std::make_shared<std::string const>(serialize(_data));
-                session->send(_message);
+    std::vector<std::uint64_t> state::get_digest(const boost::uuids::uuid session_id) const {
+        std::vector<std::uint64_t> _digest(digest_buckets, 0); {
+            std::shared_lock _lock(clients_mutex_);
+
+            if (session_id == id_) {
+                const auto &_index = clients_.get<clients_by_session>();
+
+                for (auto [_it, _end] = _index.equal_range(session_id); _it != _end; ++_it) {
+                    const auto _client_id = (*_it)->get_id();
+                    _digest[get_digest_bucket(_client_id)] ^= get_digest_hash(_client_id);
+                }
+            } else {
+                const auto &_index = remote_clients_.get<remote_clients_by_session>();
+
+                for (auto [_it, _end] = _index.equal_range(session_id); _it != _end; ++_it)
+                    _digest[get_digest_bucket(_it->id_)] ^= get_digest_hash(_it->id_);
             }
         } {
-            std::shared_lock _lock(subscriptions_mutex_);
+            std::shared_lock _lock(interests_mutex_);
+
+            const auto &_index = interests_.get<interests_by_session>();
+
+            for (auto [_it, _end] = _index.equal_range(session_id); _it != _end; ++_it)
+                _digest[get_digest_bucket(_it->channel_)] ^= get_digest_hash(_it->channel_);
+        }
+
+        return _digest;
+    }
+
+    std::size_t state::digest_to_sessions() const {
+        if (get_draining())
+            return 0;
+
+        const auto _data = make_digest_request_object(get_digest(get_id()));
+
+        return send_to_sessions(_data);
+    }
+
+    std::size_t state::drain_to_sessions() {
+        if (draining_.exchange(true, std::memory_order_acq_rel))
+            return 0;
+
+        LOG_INFO("state_id=[{}] action=[draining]", id_);
+
+        return send_to_sessions(make_draining_request_object());
+    }
+
+    bool state::get_draining() const {
+        return draining_.load(std::memory_order_acquire);
+    }
+
+    std::size_t state::clear_parked_clients() {
+        std::map<boost::uuids::uuid, std::shared_ptr<client> > _parked; {
+            std::unique_lock _lock(clients_mutex_);
+            _parked.swap(parked_clients_);
+        }
+
+        // El temporizador de cada cliente ya no encuentra su token y no vuelve a removerlo
+        for (const auto &_client: _parked | std::views::values)
+            remove_client(_client->get_id());
+
+        return _parked.size();
+    }
+
+    std::size_t state::reconcile(const std::shared_ptr<session> &session,
+                                 const std::vector<std::size_t> &buckets) const {
+        std::vector<bool> _selected(digest_buckets, false);
+        boost::json::array _reset;
+
+        for (const auto _bucket: buckets) {
+            if (_bucket < digest_buckets && !_selected[_bucket]) {
+                _selected[_bucket] = true;
+                _reset.emplace_back(_bucket);
+            }
+        }
+
+        if (_reset.empty())
+            return 0;
+
+        std::vector<boost::uuids::uuid> _clients; {
+            std::shared_lock _lock(clients_mutex_);
+
+            const auto &_index = clients_.get<clients_by_session>();
+
+            for (auto [_it, _end] = _index.equal_range(get_id()); _it != _end; ++_it) {
+                if (const auto _client_id = (*_it)->get_id(); _selected[get_digest_bucket(_client_id)])
+                    _clients.push_back(_client_id);
+            }
+        }
 
-            const auto &_index = subscriptions_.get<subscriptions_by_session>();
+        std::vector<std::string> _channels; {
+            std::shared_lock _lock(interests_mutex_);
+
+            const auto &_index = interests_.get<interests_by_session>();
 
             for (auto [_it, _end] = _index.equal_range(get_id()); _it != _end; ++_it) {
-                auto _subscription = *_it;
+                if (_selected[get_digest_bucket(_it->channel_)])
+                    _channels.push_back(_it->channel_);
+            }
+        }
 
-                boost::json::object _data = {
-                    {"action", "subscribe"},
-                    {"transaction_id", to_string(boost::uuids::random_generator()())},
-                    {
-                        "params", {
-                            {"client_id", to_string(_subscription.client_id_)},
-                            {"channel", _subscription.channel_}
-                        }
-                    }
-                };
+        return send_sync(session, _clients, _channels, _reset);
+    }
 
-                auto const _message = std::make_shared<std::string const>(serialize(_data));
-                session->send(_message);
+    std::size_t state::remove_state_of_buckets(const boost::uuids::uuid id, const std::vector<std::size_t> &buckets) {
+        std::vector<bool> _selected(digest_buckets, false);
+        for (const auto _bucket: buckets) {
+            if (_bucket < digest_buckets)
+                _selected[_bucket] = true;
+        }
+
+        std::size_t _removed = 0; {
+            std::unique_lock _lock(clients_mutex_);
+
+            auto &_index = remote_clients_.get<remote_clients_by_session>();
+            auto [_it, _end] = _index.equal_range(id);
+
+            while (_it != _end) {
+                if (_selected[get_digest_bucket(_it->id_)]) {
+                    _it = _index.erase(_it);
+                    ++_removed;
+                } else {
+                    ++_it;
+                }
+            }
+        } {
+            std::unique_lock _lock(interests_mutex_);
+
+            auto &_index = interests_.get<interests_by_session>();
+            auto [_it, _end] = _index.equal_range(id);
+
+            while (_it != _end) {
+                if (_selected[get_digest_bucket(_it->channel_)]) {
+                    if (channel_trie::is_pattern(_it->channel_))
+                        patterns_.erase(_it->channel_, id);
+
+                    _it = _index.erase(_it);
+                    ++_removed;
+                } else {
+                    ++_it;
+                }
             }
         }
+
+        return _removed;
     }
 
     boost::asio::io_context &state::get_ioc() {
         return ioc_;
     }
 
-    std::size_t state::unsubscribe_to_sessions(const request &request, const boost::uuids::uuid client_id,
-                                               const std::string &channel) const {
-        const auto _data = make_unsubscribe_request_object(request, client_id, channel);
-
-        return send_to_sessions(_data);
-    }
-
     void state::remove_state_of_session(const boost::uuids::uuid id) { {
             std::unique_lock _lock(clients_mutex_);
 
-            auto &_index = clients_.get<clients_by_session>();
+            auto &_index = remote_clients_.get<remote_clients_by_session>();
             auto [_begin, _end] = _index.equal_range(id);
 
             _index.erase(_begin, _end);
@@ -374,6 +820,18 @@ namespace aewt {
             auto &_index = subscriptions_.get<subscriptions_by_session>();
             auto [_begin, _end] = _index.equal_range(id);
 
+            _index.erase(_begin, _end);
+        } {
+            std::unique_lock _lock(interests_mutex_);
+
+            auto &_index = interests_.get<interests_by_session>();
+            auto [_begin, _end] = _index.equal_range(id);
+
+            for (auto _it = _begin; _it != _end; ++_it) {
+                if (channel_trie::is_pattern(_it->channel_))
+                    patterns_.erase(_it->channel_, id);
+            }
+
             _index.erase(_begin, _end);
         }
     }
@@ -394,7 +852,7 @@ namespace aewt {
             }
         };
 
-        auto const _message = std::make_shared<std::string const>(serialize(_data));
+        auto const _message = make_message(_data);
 
         for (const auto &_session: _sessions) {
             if (_session->get_id() == session_id) {
@@ -407,10 +865,30 @@ namespace aewt {
         return config_;
     }
 
+    dedup_cache &state::get_dedup_cache() {
+        return dedup_cache_;
+    }
+
+    history &state::get_history() {
+        return history_;
+    }
+
+    rate_limiter &state::get_rate_limiter() {
+        return rate_limiter_;
+    }
+
+    overload_detector &state::get_overload_detector() {
+        return overload_detector_;
+    }
+
+    loop_monitor &state::get_loop_monitor() {
+        return loop_monitor_;
+    }
+
     std::size_t state::send_to_sessions(const boost::json::object &data) const {
         auto _sessions = get_sessions();
 
-        auto const _message = std::make_shared<std::string const>(serialize(data));
+        auto const _message = make_message(data);
 
         for (const auto &_session: _sessions) {
             _session->send(_message);
@@ -419,15 +897,71 @@ namespace aewt {
         return _sessions.size();
     }
 
-    std::size_t state::send_to_others_clients(const std::shared_ptr<boost::json::object> &data,
+    std::size_t state::send_sync(const std::shared_ptr<session> &session,
+                                 const std::vector<boost::uuids::uuid> &clients,
+                                 const std::vector<std::string> &channels,
+                                 const boost::json::array &reset) const {
+        const auto _batch_size = std::max<std::size_t>(config_->sync_batch_size_, 1);
+
+        // El reinicio de los buckets solo viaja en el primer lote, los siguientes se acumulan sobre él.
+        auto _reset = reset;
+        std::size_t _messages = 0;
+
+        for (std::size_t _offset = 0; _offset < clients.size(); _offset += _batch_size) {
+            const auto _last = std::min(_offset + _batch_size, clients.size());
+
+            boost::json::array _batch;
+            _batch.reserve(_last - _offset);
+
+            for (auto _position = _offset; _position < _last; ++_position)
+                _batch.emplace_back(to_string(clients[_position]));
+
+            session->send(make_message(make_sync_request_object(_batch, {}, _reset)));
+            _reset.clear();
+            ++_messages;
+        }
+
+        for (std::size_t _offset = 0; _offset < channels.size(); _offset += _batch_size) {
+            const auto _last = std::min(_offset + _batch_size, channels.size());
+
+            boost::json::array _batch;
+            _batch.reserve(_last - _offset);
+
+            for (auto _position = _offset; _position < _last; ++_position)
+                _batch.emplace_back(channels[_position]);
+
+            session->send(make_message(make_sync_request_object({}, _batch, _reset)));
+            _reset.clear();
+            ++_messages;
+        }
+
+        // Sin filas en los buckets solicitados igual se debe pedir el reinicio para descartar las sobrantes.
+        if (!_reset.empty()) {
+            session->send(make_message(make_sync_request_object({}, {}, _reset)));
+            ++_messages;
+        }
+
+        return _messages;
+    }
+
+    std::vector<std::string> state::get_interest_channels(const boost::uuids::uuid &session_id) const {
+        std::shared_lock _lock(interests_mutex_);
+
+        const auto &_index = interests_.get<interests_by_session>();
+
+        std::vector<std::string> _channels;
+        for (auto [_it, _end] = _index.equal_range(session_id); _it != _end; ++_it)
+            _channels.push_back(_it->channel_);
+
+        return _channels;
+    }
+
+    std::size_t state::send_to_others_clients(const message &data,
                                               const boost::uuids::uuid session_id,
                                               const boost::uuids::uuid client_id) const {
         // Obtenemos todos los clientes
         auto _clients = get_clients();
 
-        // Construimos el mensaje compartido
-        const auto _data = std::make_shared<std::string const>(serialize(*data));
-
         // Por cada cliente en clientes
         for (const auto &_client: _clients) {
             // Con excepción del cliente emisor y los clientes que no sean de la actual sesión
@@ -435,7 +969,7 @@ namespace aewt {
                 continue;
 
             // Se envía la transmisión
-            _client->send(_data);
+            _client->send(data);
         }
 
         // Se retorna la cantidad de clientes con excepción.
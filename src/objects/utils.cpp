@@ -25,7 +25,7 @@
 
 namespace aewt {
     void next(const request &request, const char *status, const boost::json::object &data) {
-        request.response_->set_data(
+        request.response_.set_data(
             request.transaction_id_,
             status,
             request.timestamp_,
@@ -33,7 +33,7 @@ namespace aewt {
     }
 
     void mark_as_invalid(const request &request, const char *field, const char *argument) {
-        request.response_->mark_as_failed(request.transaction_id_, "unprocessable entity", request.timestamp_,
+        request.response_.mark_as_failed(request.transaction_id_, "unprocessable entity", request.timestamp_,
                                           {{field, argument}});
     }
 
@@ -65,6 +65,10 @@ namespace aewt {
         return boost::lexical_cast<boost::uuids::uuid>(std::string{params.at(field).as_string()});
     }
 
+    boost::uuids::uuid get_value_as_id(const boost::json::value &value) {
+        return boost::lexical_cast<boost::uuids::uuid>(std::string{value.as_string()});
+    }
+
     boost::json::object make_broadcast_request_object(const request &request,
                                                       const boost::uuids::uuid &client_id,
                                                       const boost::json::object &payload) {
@@ -119,34 +123,133 @@ namespace aewt {
         };
     }
 
-    boost::json::object make_subscribe_request_object(const request &request, const boost::uuids::uuid &client_id,
-                                                      const std::string &channel) {
+    boost::json::object make_interest_request_object(const boost::json::array &add,
+                                                     const boost::json::array &remove) {
         return {
-            {"transaction_id", to_string(request.transaction_id_)},
-            {"action", "subscribe"},
+            {"transaction_id", to_string(boost::uuids::random_generator()())},
+            {"action", "interest"},
             {
                 "params", {
-                    {"client_id", to_string(client_id)},
-                    {"channel", channel},
+                    {"add", add},
+                    {"remove", remove},
                 }
             }
         };
     }
 
-    boost::json::object make_unsubscribe_request_object(const request &request, const boost::uuids::uuid &client_id,
-                                                        const std::string &channel) {
+    boost::json::object make_sync_request_object(const boost::json::array &clients,
+                                                 const boost::json::array &interests,
+                                                 const boost::json::array &reset) {
+        boost::json::object _data = {
+            {"transaction_id", to_string(boost::uuids::random_generator()())},
+            {"action", "sync"},
+            {
+                "params", {
+                    {"clients", clients},
+                    {"interests", interests},
+                }
+            }
+        };
+
+        if (!reset.empty())
+            _data.at("params").as_object().emplace("reset", reset);
+
+        return _data;
+    }
+
+    boost::json::object make_digest_request_object(const std::vector<std::uint64_t> &digest) {
+        boost::json::array _buckets;
+        _buckets.reserve(digest.size());
+
+        for (const auto _hash: digest)
+            _buckets.emplace_back(_hash);
+
         return {
-            {"transaction_id", to_string(request.transaction_id_)},
-            {"action", "unsubscribe"},
+            {"transaction_id", to_string(boost::uuids::random_generator()())},
+            {"action", "digest"},
             {
                 "params", {
-                    {"client_id", to_string(client_id)},
-                    {"channel", channel},
+                    {"buckets", _buckets},
+                }
+            }
+        };
+    }
+
+    boost::json::object make_reconcile_request_object(const boost::json::array &buckets) {
+        return {
+            {"transaction_id", to_string(boost::uuids::random_generator()())},
+            {"action", "reconcile"},
+            {
+                "params", {
+                    {"buckets", buckets},
                 }
             }
         };
     }
 
+    boost::json::object make_draining_request_object() {
+        return {
+            {"transaction_id", to_string(boost::uuids::random_generator()())},
+            {"action", "draining"},
+            {"params", boost::json::object{}},
+        };
+    }
+
+    std::size_t get_digest_bucket(const boost::uuids::uuid &client_id) {
+        return client_id.data[0] >> 4;
+    }
+
+    std::size_t get_digest_bucket(const std::string_view channel) {
+        return get_digest_hash(channel) >> 60;
+    }
+
+    std::uint64_t get_digest_hash(const boost::uuids::uuid &client_id) {
+        // FNV-1a de 64 bits.
+        std::uint64_t _hash = 14695981039346656037ull;
+
+        for (const auto _byte: client_id) {
+            _hash ^= _byte;
+            _hash *= 1099511628211ull;
+        }
+
+        return _hash;
+    }
+
+    std::uint64_t get_digest_hash(const std::string_view channel) {
+        // FNV-1a de 64 bits, el prefijo separa el espacio de canales del de clientes.
+        std::uint64_t _hash = 14695981039346656037ull;
+
+        _hash ^= 0xff;
+        _hash *= 1099511628211ull;
+
+        for (const auto _character: channel) {
+            _hash ^= static_cast<std::uint8_t>(_character);
+            _hash *= 1099511628211ull;
+        }
+
+        return _hash;
+    }
+
+    std::vector<std::size_t> get_values_as_buckets(const boost::json::array &values) {
+        std::vector<std::size_t> _buckets;
+        _buckets.reserve(values.size());
+
+        for (const auto &_value: values)
+            _buckets.push_back(_value.to_number<std::size_t>());
+
+        return _buckets;
+    }
+
+    std::vector<std::string> get_values_as_strings(const boost::json::array &values) {
+        std::vector<std::string> _strings;
+        _strings.reserve(values.size());
+
+        for (const auto &_value: values)
+            _strings.emplace_back(_value.as_string());
+
+        return _strings;
+    }
+
     const char *get_status(const bool gate, const char *on_true, const char *on_false) {
         return gate
                    ? on_true
@@ -156,4 +259,27 @@ namespace aewt {
     std::string kernel_context_to_string(const kernel_context context) {
         return context == on_session ? "on_session" : "on_client";
     }
+
+    std::optional<std::string_view> get_query_param(const std::string_view target, const std::string_view name) {
+        const auto _query = target.find('?');
+        if (_query == std::string_view::npos)
+            return std::nullopt;
+
+        auto _rest = target.substr(_query + 1);
+
+        while (!_rest.empty()) {
+            const auto _end = _rest.find('&');
+            const auto _pair = _rest.substr(0, _end);
+
+            if (const auto _equal = _pair.find('='); _pair.substr(0, _equal) == name)
+                return _equal == std::string_view::npos ? std::string_view{} : _pair.substr(_equal + 1);
+
+            if (_end == std::string_view::npos)
+                break;
+
+            _rest = _rest.substr(_end + 1);
+        }
+
+        return std::nullopt;
+    }
 } // namespace aewt
@@ -70,4 +70,14 @@ namespace aewt {
             return false;
         }
     }
+
+    bool validator::is_bucket(const boost::json::value &value) {
+        if (value.is_int64())
+            return value.as_int64() >= 0 && static_cast<std::size_t>(value.as_int64()) < digest_buckets;
+
+        if (value.is_uint64())
+            return value.as_uint64() < digest_buckets;
+
+        return false;
+    }
 } // namespace aewt
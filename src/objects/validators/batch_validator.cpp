@@ -0,0 +1,65 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/validators/batch_validator.hpp>
+
+#include <aewt/request.hpp>
+#include <aewt/state.hpp>
+
+#include <aewt/utils.hpp>
+
+namespace aewt::validators {
+    bool batch_validator(const request &request) {
+        const boost::json::value &_params = get_params_as_value(request);
+        const boost::json::object &_params_object = _params.as_object();
+        if (!_params_object.contains("requests")) {
+            mark_as_invalid(request, "params", "params requests attribute must be present");
+            return false;
+        }
+
+        const boost::json::value &_requests = _params_object.at("requests");
+        if (!_requests.is_array()) {
+            mark_as_invalid(request, "params", "params requests attribute must be array");
+            return false;
+        }
+
+        if (_requests.as_array().size() > request.state_->get_config()->batch_limit_) {
+            mark_as_invalid(request, "params", "params requests attribute exceeds the batch limit");
+            return false;
+        }
+
+        for (const auto &_request: _requests.as_array()) {
+            if (!_request.is_object()) {
+                mark_as_invalid(request, "params", "params requests attribute must contain objects");
+                return false;
+            }
+
+            // Un lote no puede anidar otro, cada invocación del kernel atiende un solo nivel
+            if (const auto &_object = _request.as_object();
+                _object.contains("action") && _object.at("action").is_string() &&
+                _object.at("action").as_string() == "batch") {
+                mark_as_invalid(request, "params", "params requests attribute must not contain batches");
+                return false;
+            }
+        }
+
+        if (_params_object.contains("stream") && !_params_object.at("stream").is_bool()) {
+            mark_as_invalid(request, "params", "params stream attribute must be boolean");
+            return false;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,65 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/validators/interest_validator.hpp>
+
+#include <aewt/request.hpp>
+#include <aewt/validator.hpp>
+
+#include <aewt/utils.hpp>
+
+namespace aewt::validators {
+    bool interest_validator(const request &request) {
+        const boost::json::value &_params = get_params_as_value(request);
+        const boost::json::object &_params_object = _params.as_object();
+        if (!_params_object.contains("add")) {
+            mark_as_invalid(request, "params", "params add attribute must be present");
+            return false;
+        }
+
+        const boost::json::value &_add = _params_object.at("add");
+        if (!_add.is_array()) {
+            mark_as_invalid(request, "params", "params add attribute must be array");
+            return false;
+        }
+
+        for (const auto &_channel: _add.as_array()) {
+            if (!_channel.is_string()) {
+                mark_as_invalid(request, "params", "params add attribute must contain strings");
+                return false;
+            }
+        }
+
+        if (!_params_object.contains("remove")) {
+            mark_as_invalid(request, "params", "params remove attribute must be present");
+            return false;
+        }
+
+        const boost::json::value &_remove = _params_object.at("remove");
+        if (!_remove.is_array()) {
+            mark_as_invalid(request, "params", "params remove attribute must be array");
+            return false;
+        }
+
+        for (const auto &_channel: _remove.as_array()) {
+            if (!_channel.is_string()) {
+                mark_as_invalid(request, "params", "params remove attribute must contain strings");
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/validators/subscriptions_many_validator.hpp>
+
+#include <aewt/validators/id_validator.hpp>
+
+#include <aewt/request.hpp>
+
+#include <aewt/utils.hpp>
+
+namespace aewt::validators {
+    bool subscriptions_many_validator(const request &request) {
+        const boost::json::value &_params = get_params_as_value(request);
+        const boost::json::object &_params_object = _params.as_object();
+        if (!_params_object.contains("channels")) {
+            mark_as_invalid(request, "params", "params channels attribute must be present");
+            return false;
+        }
+
+        const boost::json::value &_channels = _params_object.at("channels");
+        if (!_channels.is_array()) {
+            mark_as_invalid(request, "params", "params channels attribute must be array");
+            return false;
+        }
+
+        for (const auto &_channel: _channels.as_array()) {
+            if (!_channel.is_string()) {
+                mark_as_invalid(request, "params", "params channels attribute must contain strings");
+                return false;
+            }
+        }
+
+        if (request.context_ == on_session) {
+            return id_validator(request, _params_object, "client_id");
+        }
+
+        return true;
+    }
+}
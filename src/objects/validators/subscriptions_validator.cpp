@@ -35,6 +35,14 @@ namespace aewt::validators {
             return false;
         }
 
+        if (_params_object.contains("since")) {
+            if (const boost::json::value &_since = _params_object.at("since");
+                !_since.is_uint64() && !(_since.is_int64() && _since.as_int64() >= 0)) {
+                mark_as_invalid(request, "params", "params since attribute must be a positive number");
+                return false;
+            }
+        }
+
         if (request.context_ == on_session) {
             return id_validator(request, _params_object, "client_id");
         }
@@ -0,0 +1,81 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <aewt/validators/sync_validator.hpp>
+
+#include <aewt/request.hpp>
+#include <aewt/validator.hpp>
+
+#include <aewt/utils.hpp>
+
+namespace aewt::validators {
+    bool sync_validator(const request &request) {
+        const boost::json::value &_params = get_params_as_value(request);
+        const boost::json::object &_params_object = _params.as_object();
+        if (!_params_object.contains("clients")) {
+            mark_as_invalid(request, "params", "params clients attribute must be present");
+            return false;
+        }
+
+        const boost::json::value &_clients = _params_object.at("clients");
+        if (!_clients.is_array()) {
+            mark_as_invalid(request, "params", "params clients attribute must be array");
+            return false;
+        }
+
+        for (const auto &_client_id: _clients.as_array()) {
+            if (!_client_id.is_string() || !validator::is_uuid(_client_id.as_string().c_str())) {
+                mark_as_invalid(request, "params", "params clients attribute must contain uuids");
+                return false;
+            }
+        }
+
+        if (!_params_object.contains("interests")) {
+            mark_as_invalid(request, "params", "params interests attribute must be present");
+            return false;
+        }
+
+        const boost::json::value &_interests = _params_object.at("interests");
+        if (!_interests.is_array()) {
+            mark_as_invalid(request, "params", "params interests attribute must be array");
+            return false;
+        }
+
+        for (const auto &_channel: _interests.as_array()) {
+            if (!_channel.is_string()) {
+                mark_as_invalid(request, "params", "params interests attribute must contain strings");
+                return false;
+            }
+        }
+
+        // El atributo reset es opcional, solo lo envía la reconciliación.
+        if (_params_object.contains("reset")) {
+            const boost::json::value &_reset = _params_object.at("reset");
+            if (!_reset.is_array()) {
+                mark_as_invalid(request, "params", "params reset attribute must be array");
+                return false;
+            }
+
+            for (const auto &_bucket: _reset.as_array()) {
+                if (!validator::is_bucket(_bucket)) {
+                    mark_as_invalid(request, "params", "params reset attribute must contain bucket indexes");
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+}
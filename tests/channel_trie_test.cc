@@ -0,0 +1,95 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <aewt/channel_trie.hpp>
+
+#include <boost/uuid/random_generator.hpp>
+
+#include <algorithm>
+
+TEST(channel_trie_test, can_detect_patterns) {
+    ASSERT_TRUE(aewt::channel_trie::is_pattern("orders.eu.*"));
+    ASSERT_TRUE(aewt::channel_trie::is_pattern("orders.#"));
+    ASSERT_TRUE(aewt::channel_trie::is_pattern("#"));
+    ASSERT_FALSE(aewt::channel_trie::is_pattern("orders.eu.1234"));
+    ASSERT_FALSE(aewt::channel_trie::is_pattern("orders.eu*"));
+}
+
+TEST(channel_trie_test, can_match_single_pattern) {
+    ASSERT_TRUE(aewt::channel_trie::matches("orders.eu.*", "orders.eu.1234"));
+    ASSERT_FALSE(aewt::channel_trie::matches("orders.eu.*", "orders.eu"));
+    ASSERT_FALSE(aewt::channel_trie::matches("orders.eu.*", "orders.eu.1234.items"));
+    ASSERT_TRUE(aewt::channel_trie::matches("orders.#", "orders"));
+    ASSERT_TRUE(aewt::channel_trie::matches("orders.#", "orders.eu.1234"));
+    ASSERT_TRUE(aewt::channel_trie::matches("orders.#.items", "orders.eu.1234.items"));
+    ASSERT_FALSE(aewt::channel_trie::matches("orders.#", "invoices.eu"));
+}
+
+TEST(channel_trie_test, can_match_topics) {
+    aewt::channel_trie _trie;
+
+    const auto _a = boost::uuids::random_generator()();
+    const auto _b = boost::uuids::random_generator()();
+    const auto _c = boost::uuids::random_generator()();
+
+    ASSERT_TRUE(_trie.insert("orders.eu.*", _a));
+    ASSERT_FALSE(_trie.insert("orders.eu.*", _a));
+    ASSERT_TRUE(_trie.insert("orders.#", _b));
+    ASSERT_TRUE(_trie.insert("*.us.*", _c));
+    ASSERT_EQ(_trie.get_size(), 3);
+
+    std::vector<boost::uuids::uuid> _output;
+    _trie.match("orders.eu.1234", _output);
+    ASSERT_EQ(_output.size(), 2);
+    ASSERT_NE(std::ranges::find(_output, _a), _output.end());
+    ASSERT_NE(std::ranges::find(_output, _b), _output.end());
+
+    _output.clear();
+    _trie.match("orders.us.1", _output);
+    ASSERT_EQ(_output.size(), 2);
+    ASSERT_NE(std::ranges::find(_output, _c), _output.end());
+
+    _output.clear();
+    _trie.match("invoices.eu.1", _output);
+    ASSERT_TRUE(_output.empty());
+}
+
+TEST(channel_trie_test, can_erase_patterns) {
+    aewt::channel_trie _trie;
+
+    const auto _a = boost::uuids::random_generator()();
+    const auto _b = boost::uuids::random_generator()();
+
+    _trie.insert("orders.eu.*", _a);
+    _trie.insert("orders.eu.*", _b);
+
+    ASSERT_FALSE(_trie.erase("orders.us.*", _a));
+    ASSERT_TRUE(_trie.erase("orders.eu.*", _a));
+    ASSERT_FALSE(_trie.erase("orders.eu.*", _a));
+
+    std::vector<boost::uuids::uuid> _output;
+    _trie.match("orders.eu.1", _output);
+    ASSERT_EQ(_output.size(), 1);
+    ASSERT_EQ(_output.front(), _b);
+
+    ASSERT_TRUE(_trie.erase("orders.eu.*", _b));
+    ASSERT_EQ(_trie.get_size(), 0);
+
+    _output.clear();
+    _trie.match("orders.eu.1", _output);
+    ASSERT_TRUE(_output.empty());
+}
@@ -0,0 +1,115 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <aewt/config.hpp>
+#include <aewt/dedup_cache.hpp>
+#include <aewt/kernel.hpp>
+#include <aewt/response.hpp>
+#include <aewt/client.hpp>
+#include <aewt/state.hpp>
+
+#include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include <algorithm>
+
+TEST(dedup_cache_test, can_find_inserted_ack) {
+    aewt::dedup_cache _cache(std::make_shared<aewt::config>());
+
+    const auto _entity_id = boost::uuids::random_generator()();
+    const auto _transaction_id = boost::uuids::random_generator()();
+
+    ASSERT_FALSE(_cache.find(_entity_id, _transaction_id).has_value());
+
+    _cache.insert(_entity_id, _transaction_id, {{"status", "success"}});
+
+    const auto _cached = _cache.find(_entity_id, _transaction_id);
+    ASSERT_TRUE(_cached.has_value());
+    ASSERT_EQ(_cached.value().at("status").as_string(), "success");
+
+    ASSERT_FALSE(_cache.find(boost::uuids::random_generator()(), _transaction_id).has_value());
+}
+
+TEST(dedup_cache_test, is_bounded_by_capacity) {
+    const auto _config = std::make_shared<aewt::config>();
+    _config->dedup_capacity_ = 64;
+
+    aewt::dedup_cache _cache(_config);
+
+    const auto _entity_id = boost::uuids::random_generator()();
+    for (int _i = 0; _i < 4096; ++_i)
+        _cache.insert(_entity_id, boost::uuids::random_generator()(), {});
+
+    ASSERT_LE(_cache.get_size(), 64);
+}
+
+TEST(dedup_cache_test, spreads_time_ordered_transactions) {
+    const auto _config = std::make_shared<aewt::config>();
+    _config->dedup_capacity_ = 64;
+
+    aewt::dedup_cache _cache(_config);
+
+    // Como un UUID v7, los primeros bytes son el instante y se repiten entre transacciones cercanas
+    const auto _entity_id = boost::uuids::random_generator()();
+    for (int _i = 0; _i < 64; ++_i) {
+        auto _transaction_id = boost::uuids::random_generator()();
+        std::fill_n(_transaction_id.begin(), 6, 0x01);
+        _cache.insert(_entity_id, _transaction_id, {});
+    }
+
+    // Con un único shard solo quedarían capacity / shards entradas
+    ASSERT_GT(_cache.get_size(), 16);
+}
+
+TEST(dedup_cache_test, can_be_disabled) {
+    const auto _config = std::make_shared<aewt::config>();
+    _config->dedup_window_ = 0;
+
+    aewt::dedup_cache _cache(_config);
+
+    const auto _entity_id = boost::uuids::random_generator()();
+    const auto _transaction_id = boost::uuids::random_generator()();
+
+    _cache.insert(_entity_id, _transaction_id, {});
+
+    ASSERT_FALSE(_cache.find(_entity_id, _transaction_id).has_value());
+    ASSERT_EQ(_cache.get_size(), 0);
+}
+
+TEST(dedup_cache_test, replays_ack_of_retried_publish) {
+    const auto _state = std::make_shared<aewt::state>();
+
+    const auto _client = std::make_shared<aewt::client>(_state->get_id(), _state);
+    _state->push_client(_client);
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "publish"},
+        {"transaction_id", to_string(_transaction_id)},
+        {"params", {{"channel", "welcome"}, {"payload", {{"message", "EHLO"}}}}}
+    };
+
+    const auto _first = aewt::kernel(_state, _data, aewt::on_client, _client->get_id());
+    const auto _second = aewt::kernel(_state, _data, aewt::on_client, _client->get_id());
+
+    ASSERT_FALSE(_first->get_failed());
+    ASSERT_TRUE(_second->get_processed());
+    ASSERT_EQ(_first->get_data(), _second->get_data());
+    ASSERT_EQ(_state->get_dedup_cache().get_size(), 1);
+
+    _state->remove_client(_client->get_id());
+}
@@ -0,0 +1,46 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <aewt/config.hpp>
+#include <aewt/deflate.hpp>
+
+TEST(deflate_test, is_disabled_by_default) {
+    const aewt::config _config;
+
+    const auto _options = aewt::get_deflate_options(_config, _config.deflate_clients_);
+
+    ASSERT_FALSE(_options.server_enable);
+    ASSERT_FALSE(_options.client_enable);
+}
+
+TEST(deflate_test, uses_configured_parameters) {
+    aewt::config _config;
+    _config.deflate_window_bits_ = 10;
+    _config.deflate_memory_level_ = 2;
+    _config.deflate_threshold_ = 1024;
+    _config.deflate_no_context_takeover_ = true;
+
+    const auto _options = aewt::get_deflate_options(_config, true);
+
+    ASSERT_TRUE(_options.server_enable);
+    ASSERT_TRUE(_options.client_enable);
+    ASSERT_EQ(_options.server_max_window_bits, 10);
+    ASSERT_EQ(_options.client_max_window_bits, 10);
+    ASSERT_EQ(_options.memLevel, 2);
+    ASSERT_EQ(_options.msg_size_threshold, 1024);
+    ASSERT_TRUE(_options.server_no_context_takeover);
+}
@@ -0,0 +1,235 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <aewt/kernel.hpp>
+#include <aewt/kernel_context.hpp>
+
+#include <aewt/response.hpp>
+#include <aewt/session.hpp>
+#include <aewt/client.hpp>
+#include <aewt/state.hpp>
+#include <aewt/logger.hpp>
+
+#include <boost/json/serialize.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include "../helpers.hpp"
+
+using namespace aewt;
+TEST(handlers_batch_handler_test, can_handle_batch_on_client) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _client = std::make_shared<client>(_state->get_id(), _state);
+
+    _state->push_client(_client);
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "batch"},
+        {"transaction_id", to_string(_transaction_id)},
+        {
+            "params", {
+                {
+                    "requests", {
+                        {
+                            {"action", "subscribe"},
+                            {"transaction_id", to_string(boost::uuids::random_generator()())},
+                            {"params", {{"channel", "welcome"}}}
+                        },
+                        {
+                            {"action", "is_subscribed"},
+                            {"transaction_id", to_string(boost::uuids::random_generator()())},
+                            {"params", {{"channel", "welcome"}}}
+                        },
+                        {
+                            {"action", "subscribe"},
+                            {"transaction_id", "invalid"},
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    const auto _response = kernel(_state, _data, on_client, _client->get_id());
+
+    LOG_INFO("response processed={} failed={} data={}", _response->get_processed(), _response->get_failed(),
+             serialize(_response->get_data()));
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(!_response->get_failed());
+
+    test_response_base_protocol_structure(_response, "success", "ok", _transaction_id);
+
+    const auto &_result = _response->get_data().at("data").as_object();
+    ASSERT_EQ(_result.at("count").as_uint64(), 3);
+    ASSERT_EQ(_result.at("failed").as_uint64(), 1);
+
+    // Los acks conservan el orden de las solicitudes
+    const auto &_responses = _result.at("responses").as_array();
+    ASSERT_EQ(_responses.size(), 3);
+    ASSERT_EQ(_responses[0].at("status").as_string(), "success");
+    ASSERT_EQ(_responses[1].at("status").as_string(), "success");
+    ASSERT_EQ(_responses[2].at("status").as_string(), "failed");
+
+    ASSERT_TRUE(_state->is_subscribed(_client->get_id(), "welcome"));
+}
+
+TEST(handlers_batch_handler_test, can_handle_streamed_batch_on_client) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _client = std::make_shared<client>(_state->get_id(), _state);
+
+    _state->push_client(_client);
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "batch"},
+        {"transaction_id", to_string(_transaction_id)},
+        {
+            "params", {
+                {"stream", true},
+                {
+                    "requests", {
+                        {
+                            {"action", "ping"},
+                            {"transaction_id", to_string(boost::uuids::random_generator()())},
+                            {"params", boost::json::object{}}
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    const auto _response = kernel(_state, _data, on_client, _client->get_id());
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(!_response->get_failed());
+
+    test_response_base_protocol_structure(_response, "success", "ok", _transaction_id);
+
+    const auto &_result = _response->get_data().at("data").as_object();
+    ASSERT_EQ(_result.at("count").as_uint64(), 1);
+    ASSERT_FALSE(_result.contains("responses"));
+}
+
+TEST(handlers_batch_handler_test, can_skip_acks_of_batch_requests_with_no_ack) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _client = std::make_shared<client>(_state->get_id(), _state);
+
+    _state->push_client(_client);
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "batch"},
+        {"transaction_id", to_string(_transaction_id)},
+        {
+            "params", {
+                {
+                    "requests", {
+                        {
+                            {"action", "subscribe"},
+                            {"transaction_id", to_string(boost::uuids::random_generator()())},
+                            {"no_ack", true},
+                            {"params", {{"channel", "welcome"}}}
+                        },
+                        {
+                            {"action", "is_subscribed"},
+                            {"transaction_id", to_string(boost::uuids::random_generator()())},
+                            {"params", {{"channel", "welcome"}}}
+                        },
+                        {
+                            {"action", "subscribe"},
+                            {"transaction_id", "invalid"},
+                            {"no_ack", true},
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    const auto _response = kernel(_state, _data, on_client, _client->get_id());
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(!_response->get_failed());
+
+    test_response_base_protocol_structure(_response, "success", "ok", _transaction_id);
+
+    const auto &_result = _response->get_data().at("data").as_object();
+    ASSERT_EQ(_result.at("count").as_uint64(), 3);
+    ASSERT_EQ(_result.at("failed").as_uint64(), 1);
+
+    // El ack exitoso con no_ack se omite, el error se informa igual
+    const auto &_responses = _result.at("responses").as_array();
+    ASSERT_EQ(_responses.size(), 2);
+    ASSERT_EQ(_responses[0].at("status").as_string(), "success");
+    ASSERT_EQ(_responses[1].at("status").as_string(), "failed");
+
+    ASSERT_TRUE(_state->is_subscribed(_client->get_id(), "welcome"));
+}
+
+TEST(handlers_batch_handler_test, can_send_requested_acks_of_batch_with_no_ack) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _client = std::make_shared<client>(_state->get_id(), _state);
+
+    _state->push_client(_client);
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "batch"},
+        {"transaction_id", to_string(_transaction_id)},
+        {"no_ack", true},
+        {
+            "params", {
+                {
+                    "requests", {
+                        {
+                            {"action", "subscribe"},
+                            {"transaction_id", to_string(boost::uuids::random_generator()())},
+                            {"params", {{"channel", "welcome"}}}
+                        },
+                        {
+                            {"action", "is_subscribed"},
+                            {"transaction_id", to_string(boost::uuids::random_generator()())},
+                            {"no_ack", false},
+                            {"params", {{"channel", "welcome"}}}
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    const auto _response = kernel(_state, _data, on_client, _client->get_id());
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(!_response->get_failed());
+
+    test_response_base_protocol_structure(_response, "success", "ok", _transaction_id);
+
+    // El resumen no se envía, el ack pedido sale por separado y no queda en él
+    const auto &_result = _response->get_data().at("data").as_object();
+    ASSERT_EQ(_result.at("count").as_uint64(), 2);
+    ASSERT_TRUE(_result.at("responses").as_array().empty());
+
+    ASSERT_TRUE(_state->is_subscribed(_client->get_id(), "welcome"));
+}
@@ -52,7 +52,7 @@ TEST(handlers_join_handler_test, can_handle_join_on_session) {
 
     _state->add_session(_remote_session);
 
-    ASSERT_FALSE(_state->get_client(_remote_client->get_id()).has_value());
+    ASSERT_FALSE(_state->get_client_exists(_remote_client->get_id()));
 
     const auto _response = kernel(_state, _data, on_session, _state->get_id());
 
@@ -67,7 +67,7 @@ TEST(handlers_join_handler_test, can_handle_join_on_session) {
     ASSERT_TRUE(_response->get_data().contains("data"));
     ASSERT_TRUE(_response->get_data().at("data").is_object());
 
-    ASSERT_TRUE(_state->get_client(_remote_client->get_id()).has_value());
+    ASSERT_TRUE(_state->get_client_exists(_remote_client->get_id()));
 
     _state->remove_session(_remote_session->get_id());
 }
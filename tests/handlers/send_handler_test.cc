@@ -80,7 +80,7 @@ TEST(handlers_send_handler_test, can_handle_remote_send_on_client) {
     const auto _other = std::make_shared<client>(_session->get_id(), _state);
 
     _state->push_client(_client);
-    _state->push_client(_other);
+    _state->push_remote_client({_other->get_id(), _session->get_id()});
 
     const auto _transaction_id = boost::uuids::random_generator()();
     const boost::json::object _data = {
@@ -158,7 +158,7 @@ TEST(handlers_send_handler_test, can_handle_send_on_session) {
     const auto _other = std::make_shared<client>(_session->get_id(), _state);
 
     _state->push_client(_client);
-    _state->push_client(_other);
+    _state->push_remote_client({_other->get_id(), _session->get_id()});
     _state->add_session(_session);
 
     const auto _transaction_id = boost::uuids::random_generator()();
@@ -200,7 +200,7 @@ TEST(handlers_send_handler_test, can_handle_send_no_effect_on_session) {
     const auto _other = std::make_shared<client>(_session->get_id(), _state);
 
     _state->push_client(_client);
-    _state->push_client(_other);
+    _state->push_remote_client({_other->get_id(), _session->get_id()});
     _state->add_session(_session);
 
     const auto _transaction_id = boost::uuids::random_generator()();
@@ -0,0 +1,64 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <aewt/kernel.hpp>
+#include <aewt/kernel_context.hpp>
+
+#include <aewt/response.hpp>
+#include <aewt/client.hpp>
+#include <aewt/state.hpp>
+#include <aewt/logger.hpp>
+
+#include <boost/json/serialize.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include "../helpers.hpp"
+
+using namespace aewt;
+
+TEST(handlers_stats_handler_test, can_handle_stats) {
+    const auto _state = std::make_shared<state>();
+    _state->get_loop_monitor().start(2);
+
+    const auto _client = std::make_shared<client>(_state->get_id(), _state);
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "stats"},
+        {"transaction_id", to_string(_transaction_id)},
+    };
+
+    const auto _response = kernel(_state, _data, on_client, _client->get_id());
+
+    LOG_INFO("response processed={} failed={} data={}", _response->get_processed(), _response->get_failed(),
+             serialize(_response->get_data()));
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(!_response->get_failed());
+
+    test_response_base_protocol_structure(_response, "success", "ok", _transaction_id);
+
+    const auto &_stats = _response->get_data().at("data").as_object();
+    ASSERT_TRUE(_stats.at("threads").is_array());
+    ASSERT_EQ(_stats.at("threads").as_array().size(), 2);
+    ASSERT_TRUE(_stats.at("threads").as_array().at(0).as_object().contains("lag"));
+    ASSERT_TRUE(_stats.at("threads").as_array().at(0).as_object().contains("handlers_per_second"));
+    ASSERT_TRUE(_stats.at("threads").as_array().at(0).as_object().contains("busy"));
+    ASSERT_EQ(_stats.at("pending").as_uint64(), 0);
+    ASSERT_FALSE(_stats.at("overloaded").as_bool());
+}
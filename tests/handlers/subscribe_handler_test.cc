@@ -124,4 +124,53 @@ TEST(handlers_subscribe_handler_test, can_handle_subscribe_on_session) {
     ASSERT_TRUE(_response->get_data().at("data").is_object());
 
     _state->remove_session(_client->get_id());
-}
\ No newline at end of file
+}
+
+TEST(handlers_subscribe_handler_test, can_handle_subscribe_since_on_client) {
+    const auto _config = std::make_shared<config>();
+    _config->history_size_ = 16;
+
+    const auto _state = std::make_shared<state>(_config);
+
+    const auto _publisher = std::make_shared<client>(_state->get_id(), _state);
+    const auto _client = std::make_shared<client>(_state->get_id(), _state);
+
+    _state->push_client(_publisher);
+    _state->push_client(_client);
+
+    // Cada publicación lleva su propia transacción para no ser respondida desde el dedup
+    for (int _i = 0; _i < 2; ++_i) {
+        const boost::json::object _publish = {
+            {"action", "publish"},
+            {"transaction_id", to_string(boost::uuids::random_generator()())},
+            {
+                "params",
+                {
+                    {"channel", "welcome"},
+                    {"payload", {{"message", "EHLO"}}}
+                }
+            }
+        };
+
+        kernel(_state, _publish, on_client, _publisher->get_id());
+    }
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "subscribe"},
+        {"transaction_id", to_string(_transaction_id)},
+        {"params", {{"channel", "welcome"}, {"since", 1}}}
+    };
+
+    const auto _response = kernel(_state, _data, on_client, _client->get_id());
+
+    LOG_INFO("response processed={} failed={} data={}", _response->get_processed(), _response->get_failed(),
+             serialize(_response->get_data()));
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(!_response->get_failed());
+
+    test_response_base_protocol_structure(_response, "success", "ok", _transaction_id);
+
+    ASSERT_EQ(_response->get_data().at("data").at("replayed").as_uint64(), 1);
+}
@@ -0,0 +1,120 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <aewt/kernel.hpp>
+#include <aewt/kernel_context.hpp>
+
+#include <aewt/response.hpp>
+#include <aewt/session.hpp>
+#include <aewt/client.hpp>
+#include <aewt/state.hpp>
+#include <aewt/logger.hpp>
+
+#include <boost/json/serialize.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include "../helpers.hpp"
+
+using namespace aewt;
+
+TEST(handlers_subscribe_many_handler_test, can_handle_subscribe_many_on_client) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _client = std::make_shared<client>(_state->get_id(), _state);
+
+    _state->push_client(_client);
+    _state->subscribe(_state->get_id(), _client->get_id(), "goodbye");
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "subscribe_many"},
+        {"transaction_id", to_string(_transaction_id)},
+        {"params", {{"channels", {"welcome", "goodbye", "orders.#"}}}}
+    };
+
+    const auto _response = kernel(_state, _data, on_client, _client->get_id());
+
+    LOG_INFO("response processed={} failed={} data={}", _response->get_processed(), _response->get_failed(),
+             serialize(_response->get_data()));
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(!_response->get_failed());
+
+    test_response_base_protocol_structure(_response, "success", "ok", _transaction_id);
+
+    const auto &_result = _response->get_data().at("data").as_object();
+    ASSERT_EQ(_result.at("count").as_int64(), 2);
+    ASSERT_EQ(_result.at("channels").at("welcome").as_string(), "ok");
+    ASSERT_EQ(_result.at("channels").at("goodbye").as_string(), "no effect");
+    ASSERT_EQ(_result.at("channels").at("orders.#").as_string(), "ok");
+
+    ASSERT_EQ(_state->get_subscriptions().size(), 3);
+    ASSERT_EQ(_state->get_interests().size(), 3);
+}
+
+TEST(handlers_subscribe_many_handler_test, can_handle_subscribe_many_no_effect_on_client) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _client = std::make_shared<client>(_state->get_id(), _state);
+
+    _state->push_client(_client);
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "subscribe_many"},
+        {"transaction_id", to_string(_transaction_id)},
+        {"params", {{"channels", boost::json::array{}}}}
+    };
+
+    const auto _response = kernel(_state, _data, on_client, _client->get_id());
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(!_response->get_failed());
+
+    test_response_base_protocol_structure(_response, "success", "no effect", _transaction_id);
+}
+
+TEST(handlers_subscribe_many_handler_test, can_handle_subscribe_many_on_session) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _session_id = boost::uuids::random_generator()();
+    const auto _client_id = boost::uuids::random_generator()();
+
+    _state->push_remote_client({_client_id, _session_id});
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "subscribe_many"},
+        {"transaction_id", to_string(_transaction_id)},
+        {"params", {
+            {"client_id", to_string(_client_id)},
+            {"channels", {"welcome", "goodbye"}},
+        }}
+    };
+
+    const auto _response = kernel(_state, _data, on_session, _session_id);
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(!_response->get_failed());
+
+    test_response_base_protocol_structure(_response, "success", "ok", _transaction_id);
+
+    ASSERT_TRUE(_state->get_subscriptions().empty());
+    ASSERT_EQ(_state->get_interests().size(), 2);
+    ASSERT_TRUE(_state->is_subscribed(_client_id, "goodbye"));
+}
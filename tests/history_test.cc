@@ -0,0 +1,94 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <aewt/config.hpp>
+#include <aewt/history.hpp>
+
+TEST(history_test, is_disabled_by_default) {
+    aewt::history _history(std::make_shared<aewt::config>());
+
+    ASSERT_FALSE(_history.get_enabled());
+
+    _history.push("welcome", _history.next_sequence(), aewt::message("EHLO"));
+
+    ASSERT_TRUE(_history.replay("welcome", 0).empty());
+    ASSERT_EQ(_history.get_bytes(), 0);
+}
+
+TEST(history_test, can_replay_since_sequence) {
+    const auto _config = std::make_shared<aewt::config>();
+    _config->history_size_ = 2;
+
+    aewt::history _history(_config);
+
+    const auto _first = _history.next_sequence();
+    const auto _second = _history.next_sequence();
+    const auto _third = _history.next_sequence();
+
+    _history.push("welcome", _first, aewt::message("first"));
+    _history.push("welcome", _third, aewt::message("third"));
+    _history.push("welcome", _second, aewt::message("second"));
+
+    // Solo se retienen las dos últimas publicaciones del canal
+    const auto _messages = _history.replay("welcome", 0);
+    ASSERT_EQ(_messages.size(), 2);
+    ASSERT_EQ(_messages[0].get_view(), "second");
+    ASSERT_EQ(_messages[1].get_view(), "third");
+
+    ASSERT_EQ(_history.replay("welcome", _second).size(), 1);
+    ASSERT_TRUE(_history.replay("welcome", _third).empty());
+    ASSERT_TRUE(_history.replay("goodbye", 0).empty());
+}
+
+TEST(history_test, can_replay_patterns_in_order) {
+    const auto _config = std::make_shared<aewt::config>();
+    _config->history_size_ = 8;
+
+    aewt::history _history(_config);
+
+    _history.push("orders.eu.1", _history.next_sequence(), aewt::message("a"));
+    _history.push("orders.us.1", _history.next_sequence(), aewt::message("b"));
+    _history.push("invoices.eu.1", _history.next_sequence(), aewt::message("c"));
+    _history.push("orders.eu.2", _history.next_sequence(), aewt::message("d"));
+
+    const auto _messages = _history.replay("orders.#", 0);
+    ASSERT_EQ(_messages.size(), 3);
+    ASSERT_EQ(_messages[0].get_view(), "a");
+    ASSERT_EQ(_messages[1].get_view(), "b");
+    ASSERT_EQ(_messages[2].get_view(), "d");
+}
+
+TEST(history_test, can_evict_least_recently_used_channel) {
+    const auto _config = std::make_shared<aewt::config>();
+    _config->history_size_ = 8;
+    _config->history_capacity_ = 8;
+
+    aewt::history _history(_config);
+
+    _history.push("welcome", _history.next_sequence(), aewt::message("1234"));
+    _history.push("goodbye", _history.next_sequence(), aewt::message("1234"));
+
+    // Consultar el canal lo vuelve el más reciente
+    ASSERT_EQ(_history.replay("welcome", 0).size(), 1);
+
+    _history.push("other", _history.next_sequence(), aewt::message("1234"));
+
+    ASSERT_EQ(_history.get_bytes(), 8);
+    ASSERT_EQ(_history.replay("welcome", 0).size(), 1);
+    ASSERT_TRUE(_history.replay("goodbye", 0).empty());
+    ASSERT_EQ(_history.replay("other", 0).size(), 1);
+}
@@ -282,3 +282,20 @@ TEST(kernel_test, on_ack) {
     ASSERT_TRUE(_response->get_processed());
     ASSERT_TRUE(_response->is_ack());
 }
+
+TEST(kernel_test, on_caller_response) {
+    const auto _state = std::make_shared<state>();
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "ping"}, {"transaction_id", to_string(_transaction_id)},
+    };
+
+    response _response;
+    kernel(_state, _data, on_client, boost::uuids::random_generator()(), _response);
+
+    ASSERT_TRUE(_response.get_processed());
+    ASSERT_FALSE(_response.get_failed());
+    ASSERT_TRUE(_response.get_data().contains("transaction_id"));
+    ASSERT_EQ(_response.get_data().at("transaction_id").as_string(), to_string(_transaction_id));
+}
@@ -0,0 +1,47 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <aewt/logger.hpp>
+
+#include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+TEST(logger_test, can_format_uuid) {
+    const auto _id = boost::uuids::random_generator()();
+    ASSERT_EQ(fmt::format("{}", _id), to_string(_id));
+    ASSERT_EQ(fmt::format("[{}]", boost::uuids::uuid{}), "[00000000-0000-0000-0000-000000000000]");
+}
+
+TEST(logger_test, can_change_level_and_sampling) {
+    ASSERT_TRUE(aewt::logger::set_level("warn"));
+    ASSERT_FALSE(aewt::logger::should_log());
+    ASSERT_FALSE(aewt::logger::set_level("unknown"));
+    ASSERT_TRUE(aewt::logger::set_level("info"));
+    ASSERT_TRUE(aewt::logger::should_log());
+
+    aewt::logger::set_sampling(4);
+    ASSERT_EQ(aewt::logger::get_sampling(), 4);
+
+    std::size_t _kept = 0;
+    for (std::size_t _i = 0; _i < 100; ++_i) {
+        if (aewt::logger::should_log())
+            ++_kept;
+    }
+    ASSERT_EQ(_kept, 25);
+
+    aewt::logger::set_sampling(1);
+}
@@ -0,0 +1,90 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <aewt/config.hpp>
+#include <aewt/loop_monitor.hpp>
+#include <aewt/overload_detector.hpp>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include <thread>
+
+TEST(loop_monitor_test, is_idle_until_started) {
+    boost::asio::io_context _io_context;
+
+    const auto _config = std::make_shared<aewt::config>();
+    aewt::overload_detector _overload_detector(_config);
+    aewt::loop_monitor _monitor(_io_context, _config, _overload_detector);
+
+    ASSERT_TRUE(_monitor.get_enabled());
+    ASSERT_TRUE(_monitor.get_stats().empty());
+
+    // Sin start el hilo corre el io context como siempre
+    std::size_t _handled = 0;
+    boost::asio::post(_io_context, [&_handled] { ++_handled; });
+    _monitor.run(0);
+
+    ASSERT_EQ(_handled, 1);
+}
+
+TEST(loop_monitor_test, can_sample_threads) {
+    boost::asio::io_context _io_context;
+
+    const auto _config = std::make_shared<aewt::config>();
+    _config->monitor_interval_ = 10;
+
+    aewt::overload_detector _overload_detector(_config);
+    aewt::loop_monitor _monitor(_io_context, _config, _overload_detector);
+
+    _monitor.start(1);
+
+    // Un handler que bloquea el hilo retrasa los timers del monitor
+    boost::asio::steady_timer _block(_io_context, std::chrono::milliseconds(5));
+    _block.async_wait([](const boost::system::error_code &) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    });
+
+    boost::asio::steady_timer _stop(_io_context, std::chrono::milliseconds(80));
+    _stop.async_wait([&_io_context](const boost::system::error_code &) { _io_context.stop(); });
+
+    _monitor.run(0);
+
+    const auto _stats = _monitor.get_stats();
+    ASSERT_EQ(_stats.size(), 1);
+    ASSERT_GT(_stats[0].handlers_per_second_, 0);
+    ASSERT_GE(_stats[0].busy_, 0);
+    ASSERT_LE(_stats[0].busy_, 1);
+
+    ASSERT_GT(_overload_detector.get_lag().count(), 0);
+}
+
+TEST(loop_monitor_test, can_be_disabled) {
+    boost::asio::io_context _io_context;
+
+    const auto _config = std::make_shared<aewt::config>();
+    _config->monitor_interval_ = 0;
+
+    aewt::overload_detector _overload_detector(_config);
+    aewt::loop_monitor _monitor(_io_context, _config, _overload_detector);
+
+    _monitor.start(4);
+    _monitor.run(0);
+
+    ASSERT_FALSE(_monitor.get_enabled());
+    ASSERT_TRUE(_monitor.get_stats().empty());
+}
@@ -0,0 +1,56 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <aewt/message.hpp>
+
+#include <boost/json/serialize.hpp>
+
+TEST(message_test, can_share_payload) {
+    const aewt::message _message("welcome");
+
+    ASSERT_EQ(_message.get_view(), "welcome");
+    ASSERT_EQ(_message.get_size(), 7);
+    ASSERT_EQ(_message.get_use_count(), 1);
+
+    {
+        const auto _copy = _message;
+
+        ASSERT_EQ(_copy.get_data(), _message.get_data());
+        ASSERT_EQ(_message.get_use_count(), 2);
+    }
+
+    ASSERT_EQ(_message.get_use_count(), 1);
+}
+
+TEST(message_test, can_move_payload) {
+    aewt::message _message("welcome");
+    const auto *_data = _message.get_data();
+
+    const auto _moved = std::move(_message);
+
+    ASSERT_EQ(_moved.get_data(), _data);
+    ASSERT_EQ(_moved.get_use_count(), 1);
+    ASSERT_EQ(_message.get_size(), 0);
+}
+
+TEST(message_test, can_make_message) {
+    const boost::json::object _data = {{"action", "ping"}, {"params", {{"payload", std::string(8192, 'a')}}}};
+
+    const auto _message = aewt::make_message(_data);
+
+    ASSERT_EQ(_message.get_view(), serialize(_data));
+}
@@ -0,0 +1,50 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <aewt/pool.hpp>
+
+#include <string>
+
+namespace {
+    /**
+     * Pooled
+     */
+    struct pooled : std::enable_shared_from_this<pooled> {
+        std::string value_;
+
+        explicit pooled(std::string value) : value_(std::move(value)) {
+        }
+    };
+}
+
+TEST(pool_test, can_make_pooled_objects) {
+    const auto _object = aewt::make_pooled<pooled>("welcome");
+
+    ASSERT_EQ(_object->value_, "welcome");
+    ASSERT_EQ(_object->shared_from_this(), _object);
+    ASSERT_EQ(_object.use_count(), 1);
+}
+
+TEST(pool_test, can_reuse_pool_resource) {
+    ASSERT_NE(aewt::get_pool_resource(), nullptr);
+    ASSERT_EQ(aewt::get_pool_resource(), aewt::get_pool_resource());
+
+    for (int _i = 0; _i < 1024; ++_i) {
+        const auto _message = aewt::make_pooled<std::string const>(std::string(16, 'a'));
+        ASSERT_EQ(_message->size(), 16);
+    }
+}
@@ -0,0 +1,158 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <aewt/config.hpp>
+#include <aewt/rate_limiter.hpp>
+#include <aewt/kernel.hpp>
+#include <aewt/response.hpp>
+#include <aewt/client.hpp>
+#include <aewt/state.hpp>
+
+#include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+TEST(rate_limiter_test, allows_everything_when_disabled) {
+    aewt::rate_limiter _limiter(std::make_shared<aewt::config>());
+
+    const auto _entity_id = boost::uuids::random_generator()();
+    for (int _i = 0; _i < 1024; ++_i)
+        ASSERT_TRUE(_limiter.try_acquire(_entity_id, true));
+
+    ASSERT_FALSE(_limiter.get_enabled());
+    ASSERT_EQ(_limiter.get_size(), 0);
+}
+
+TEST(rate_limiter_test, can_limit_requests_to_burst) {
+    const auto _config = std::make_shared<aewt::config>();
+    _config->client_rate_ = 1;
+    _config->client_burst_ = 8;
+
+    aewt::rate_limiter _limiter(_config);
+
+    const auto _entity_id = boost::uuids::random_generator()();
+    for (int _i = 0; _i < 8; ++_i)
+        ASSERT_TRUE(_limiter.try_acquire(_entity_id, false));
+
+    ASSERT_FALSE(_limiter.try_acquire(_entity_id, false));
+
+    // Cada cliente tiene sus propios buckets
+    ASSERT_TRUE(_limiter.try_acquire(boost::uuids::random_generator()(), false));
+}
+
+TEST(rate_limiter_test, can_limit_fanout_apart_from_requests) {
+    const auto _config = std::make_shared<aewt::config>();
+    _config->fanout_rate_ = 1;
+    _config->fanout_burst_ = 2;
+
+    aewt::rate_limiter _limiter(_config);
+
+    const auto _entity_id = boost::uuids::random_generator()();
+    ASSERT_TRUE(_limiter.try_acquire(_entity_id, true));
+    ASSERT_TRUE(_limiter.try_acquire(_entity_id, true));
+    ASSERT_FALSE(_limiter.try_acquire(_entity_id, true));
+
+    ASSERT_TRUE(_limiter.try_acquire(_entity_id, false));
+}
+
+TEST(rate_limiter_test, does_not_spend_fanout_when_requests_are_exhausted) {
+    const auto _config = std::make_shared<aewt::config>();
+    _config->client_rate_ = 1;
+    _config->client_burst_ = 1;
+    _config->fanout_rate_ = 1;
+    _config->fanout_burst_ = 1;
+
+    aewt::rate_limiter _limiter(_config);
+
+    const auto _entity_id = boost::uuids::random_generator()();
+    ASSERT_TRUE(_limiter.try_acquire(_entity_id, false));
+    ASSERT_FALSE(_limiter.try_acquire(_entity_id, true));
+
+    _limiter.remove(_entity_id);
+    ASSERT_EQ(_limiter.get_size(), 0);
+
+    ASSERT_TRUE(_limiter.try_acquire(_entity_id, true));
+}
+
+TEST(rate_limiter_test, rejects_requests_of_clients_above_the_rate) {
+    const auto _state = std::make_shared<aewt::state>();
+    _state->get_config()->fanout_rate_ = 1;
+    _state->get_config()->fanout_burst_ = 1;
+
+    const auto _client = std::make_shared<aewt::client>(_state->get_id(), _state);
+    _state->push_client(_client);
+
+    const auto _request = [&] {
+        const boost::json::object _data = {
+            {"action", "broadcast"},
+            {"transaction_id", to_string(boost::uuids::random_generator()())},
+            {"params", {{"payload", {{"message", "EHLO"}}}}}
+        };
+        return aewt::kernel(_state, _data, aewt::on_client, _client->get_id());
+    };
+
+    ASSERT_FALSE(_request()->get_failed());
+
+    const auto _rejected = _request();
+    ASSERT_TRUE(_rejected->get_processed());
+    ASSERT_TRUE(_rejected->get_failed());
+    ASSERT_EQ(_rejected->get_data().at("message").as_string(), "too many requests");
+
+    // Las solicitudes sin fan-out conservan su propio bucket
+    const boost::json::object _ping = {
+        {"action", "ping"},
+        {"transaction_id", to_string(boost::uuids::random_generator()())},
+    };
+    ASSERT_FALSE(aewt::kernel(_state, _ping, aewt::on_client, _client->get_id())->get_failed());
+
+    _state->remove_client(_client->get_id());
+    ASSERT_EQ(_state->get_rate_limiter().get_size(), 0);
+}
+
+TEST(rate_limiter_test, sheds_fanout_of_clients_when_overloaded) {
+    const auto _state = std::make_shared<aewt::state>();
+    _state->get_config()->overload_pending_ = 4;
+
+    const auto _client = std::make_shared<aewt::client>(_state->get_id(), _state);
+    _state->push_client(_client);
+
+    _state->get_overload_detector().on_enqueued(8);
+    ASSERT_TRUE(_state->get_overload_detector().get_overloaded());
+
+    const boost::json::object _broadcast = {
+        {"action", "broadcast"},
+        {"transaction_id", to_string(boost::uuids::random_generator()())},
+        {"params", {{"payload", {{"message", "EHLO"}}}}}
+    };
+
+    const auto _shed = aewt::kernel(_state, _broadcast, aewt::on_client, _client->get_id());
+    ASSERT_TRUE(_shed->get_failed());
+    ASSERT_EQ(_shed->get_data().at("message").as_string(), "service unavailable");
+
+    const boost::json::object _ping = {
+        {"action", "ping"},
+        {"transaction_id", to_string(boost::uuids::random_generator()())},
+    };
+    ASSERT_FALSE(aewt::kernel(_state, _ping, aewt::on_client, _client->get_id())->get_failed());
+
+    _state->get_overload_detector().on_dequeued(8);
+    ASSERT_FALSE(_state->get_overload_detector().get_overloaded());
+
+    const auto _accepted = aewt::kernel(_state, _broadcast, aewt::on_client, _client->get_id());
+    ASSERT_FALSE(_accepted->get_failed());
+
+    _state->remove_client(_client->get_id());
+}
@@ -17,10 +17,13 @@
 
 #include "server_base.hpp"
 #include <aewt/logger.hpp>
+#include <aewt/client.hpp>
+#include <aewt/message.hpp>
 #include <boost/json/serialize.hpp>
 #include <boost/uuid/uuid_io.hpp>
 #include <boost/asio/strand.hpp>
 #include <boost/json/parse.hpp>
+#include <boost/lexical_cast.hpp>
 
 TEST_F(server_test, servers_are_registered) {
     // Server isn't registered as isn't node
@@ -479,8 +482,266 @@ TEST_F(server_test, assert_server_can_handle_sync) {
 
     std::this_thread::sleep_for(std::chrono::seconds(5));
 
-    ASSERT_EQ(_server_e->get_state()->get_subscriptions().size(), 1);
-    ASSERT_EQ(_server_e->get_state()->get_clients().size(), 2);
+    ASSERT_TRUE(_server_e->get_state()->get_subscriptions().empty());
+    ASSERT_EQ(_server_e->get_state()->get_interests().size(), 1);
+    ASSERT_TRUE(_server_e->get_state()->get_clients().empty());
+    ASSERT_EQ(_server_e->get_state()->get_remote_clients().size(), 2);
 
     _server_e->stop();
 }
+
+TEST_F(server_test, server_can_resume_clients) {
+    server_b_->get_config()->resume_window_ = 10;
+
+    boost::asio::io_context _ioc;
+    boost::asio::ip::tcp::resolver _resolver{make_strand(_ioc)};
+
+    auto const _results = _resolver.resolve("127.0.0.1", std::to_string(server_b_->get_config()->clients_port_.load(std::memory_order_acquire)));
+    const auto _host = fmt::format("127.0.0.1:{}", std::to_string(server_b_->get_config()->clients_port_.load(std::memory_order_acquire)));
+
+    std::string _client_id;
+    std::string _resume_token;
+
+    {
+        boost::beast::websocket::stream<boost::asio::ip::tcp::socket> _client{make_strand(_ioc)};
+        boost::asio::connect(_client.next_layer(), _results);
+        _client.handshake(_host, "/");
+
+        boost::beast::flat_buffer _accepted_buffer;
+        _client.read(_accepted_buffer);
+
+        auto _accepted_object = boost::json::parse(boost::beast::buffers_to_string(_accepted_buffer.data()));
+        const auto &_data = _accepted_object.as_object().at("data").as_object();
+
+        ASSERT_TRUE(_data.contains("resume_token"));
+        _client_id = _data.at("client_id").as_string();
+        _resume_token = _data.at("resume_token").as_string();
+
+        _client.write(boost::asio::buffer(std::string(serialize(boost::json::object{
+            {"transaction_id", to_string(boost::uuids::random_generator()())},
+            {"action", "subscribe"},
+            {"params", {{"channel", "welcome"}}},
+        }))));
+
+        boost::beast::flat_buffer _buffer;
+        _client.read(_buffer);
+
+        // Se corta la conexión sin cerrar el websocket
+        boost::system::error_code ec;
+        _client.next_layer().close(ec);
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    const auto _id = boost::lexical_cast<boost::uuids::uuid>(_client_id);
+
+    // Estacionado, los pares no reciben la salida del cliente
+    ASSERT_EQ(server_b_->get_state()->get_clients().size(), 1);
+    ASSERT_TRUE(server_a_->get_state()->get_client_exists(_id));
+    ASSERT_TRUE(server_c_->get_state()->get_client_exists(_id));
+
+    boost::beast::websocket::stream<boost::asio::ip::tcp::socket> _client{make_strand(_ioc)};
+    boost::asio::connect(_client.next_layer(), _results);
+    _client.handshake(_host, fmt::format("/?resume_token={}", _resume_token));
+
+    boost::beast::flat_buffer _accepted_buffer;
+    _client.read(_accepted_buffer);
+
+    auto _accepted_object = boost::json::parse(boost::beast::buffers_to_string(_accepted_buffer.data()));
+    const auto &_data = _accepted_object.as_object().at("data").as_object();
+
+    ASSERT_EQ(std::string(_data.at("client_id").as_string()), _client_id);
+    ASSERT_TRUE(_data.at("resumed").as_bool());
+    ASSERT_NE(std::string(_data.at("resume_token").as_string()), _resume_token);
+
+    ASSERT_EQ(server_b_->get_state()->get_clients().size(), 1);
+    ASSERT_TRUE(server_b_->get_state()->is_subscribed(_id, "welcome"));
+
+    boost::system::error_code ec;
+    _client.close(boost::beast::websocket::close_code::normal, ec);
+}
+
+TEST_F(server_test, server_can_park_clients_with_a_write_in_flight) {
+    server_b_->get_config()->resume_window_ = 10;
+    server_b_->get_config()->resume_buffer_ = 2;
+
+    boost::asio::io_context _ioc;
+    boost::asio::ip::tcp::resolver _resolver{make_strand(_ioc)};
+
+    auto const _results = _resolver.resolve("127.0.0.1", std::to_string(server_b_->get_config()->clients_port_.load(std::memory_order_acquire)));
+    const auto _host = fmt::format("127.0.0.1:{}", std::to_string(server_b_->get_config()->clients_port_.load(std::memory_order_acquire)));
+
+    std::string _client_id;
+    std::string _resume_token;
+
+    // Mensajes grandes para que el socket se llene y quede una escritura en curso
+    const auto _message = aewt::make_message(boost::json::object{
+        {"action", "publish"},
+        {"payload", std::string(262144, 'x')},
+    });
+
+    {
+        boost::beast::websocket::stream<boost::asio::ip::tcp::socket> _client{make_strand(_ioc)};
+        boost::asio::connect(_client.next_layer(), _results);
+        _client.handshake(_host, "/");
+
+        boost::beast::flat_buffer _accepted_buffer;
+        _client.read(_accepted_buffer);
+
+        auto _accepted_object = boost::json::parse(boost::beast::buffers_to_string(_accepted_buffer.data()));
+        const auto &_data = _accepted_object.as_object().at("data").as_object();
+        _client_id = _data.at("client_id").as_string();
+        _resume_token = _data.at("resume_token").as_string();
+
+        const auto _id = boost::lexical_cast<boost::uuids::uuid>(_client_id);
+        const auto _parked = server_b_->get_state()->get_client(_id);
+        ASSERT_TRUE(_parked.has_value());
+
+        for (std::size_t _i = 0; _i < 64; ++_i)
+            _parked.value()->send(_message);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+        // Se corta con RST sin leer nada, el servidor sigue escribiendo
+        boost::system::error_code ec;
+        _client.next_layer().set_option(boost::asio::socket_base::linger(true, 0), ec);
+        _client.next_layer().close(ec);
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    const auto _id = boost::lexical_cast<boost::uuids::uuid>(_client_id);
+    ASSERT_EQ(server_b_->get_state()->get_clients().size(), 1);
+
+    // Lo enviado mientras está estacionado desplaza lo más antiguo más allá del buffer
+    for (std::size_t _i = 0; _i < 8; ++_i)
+        server_b_->get_state()->get_client(_id).value()->send(_message);
+
+    boost::beast::websocket::stream<boost::asio::ip::tcp::socket> _client{make_strand(_ioc)};
+    boost::asio::connect(_client.next_layer(), _results);
+    _client.handshake(_host, fmt::format("/?resume_token={}", _resume_token));
+
+    boost::beast::flat_buffer _accepted_buffer;
+    _client.read(_accepted_buffer);
+
+    auto _accepted_object = boost::json::parse(boost::beast::buffers_to_string(_accepted_buffer.data()));
+    const auto &_data = _accepted_object.as_object().at("data").as_object();
+
+    ASSERT_TRUE(_data.at("resumed").as_bool());
+    ASSERT_GT(_data.at("dropped").as_uint64(), 0);
+
+    for (std::size_t _i = 0; _i < 2; ++_i) {
+        boost::beast::flat_buffer _buffer;
+        _client.read(_buffer);
+        ASSERT_EQ(_buffer.size(), _message.get_buffer().size());
+    }
+
+    boost::system::error_code ec;
+    _client.close(boost::beast::websocket::close_code::normal, ec);
+}
+
+TEST_F(server_test, server_can_skip_successful_acks) {
+    boost::asio::io_context _ioc;
+    boost::asio::ip::tcp::resolver _resolver{make_strand(_ioc)};
+    boost::beast::websocket::stream<boost::asio::ip::tcp::socket> _client{make_strand(_ioc)};
+
+    auto const _results = _resolver.resolve("127.0.0.1", std::to_string(server_a_->get_config()->clients_port_.load(std::memory_order_acquire)));
+    boost::asio::connect(_client.next_layer(), _results);
+
+    const auto _host = fmt::format("127.0.0.1:{}", std::to_string(server_a_->get_config()->clients_port_.load(std::memory_order_acquire)));
+    _client.handshake(_host, "/?no_ack=1");
+
+    {
+        boost::beast::flat_buffer _buffer;
+        _client.read(_buffer);
+
+        auto _accepted_object = boost::json::parse(boost::beast::buffers_to_string(_buffer.data()));
+        ASSERT_TRUE(_accepted_object.as_object().at("data").as_object().at("no_ack").as_bool());
+    }
+
+    _client.write(boost::asio::buffer(std::string(serialize(boost::json::object{
+        {"transaction_id", to_string(boost::uuids::random_generator()())},
+        {"action", "subscribe"},
+        {"params", {{"channel", "welcome"}}},
+    }))));
+
+    const auto _failed_transaction_id = to_string(boost::uuids::random_generator()());
+    _client.write(boost::asio::buffer(std::string(serialize(boost::json::object{
+        {"transaction_id", _failed_transaction_id},
+        {"action", "subscribe"},
+        {"params", boost::json::object{}},
+    }))));
+
+    const auto _requested_transaction_id = to_string(boost::uuids::random_generator()());
+    _client.write(boost::asio::buffer(std::string(serialize(boost::json::object{
+        {"transaction_id", _requested_transaction_id},
+        {"action", "ping"},
+        {"no_ack", false},
+    }))));
+
+    // El primer frame recibido es el error, el éxito de la suscripción no tiene ack
+    {
+        boost::beast::flat_buffer _buffer;
+        _client.read(_buffer);
+
+        auto _object = boost::json::parse(boost::beast::buffers_to_string(_buffer.data()));
+        ASSERT_EQ(_object.as_object().at("status").as_string(), "failed");
+        ASSERT_EQ(_object.as_object().at("transaction_id").as_string(), _failed_transaction_id);
+    }
+
+    {
+        boost::beast::flat_buffer _buffer;
+        _client.read(_buffer);
+
+        auto _object = boost::json::parse(boost::beast::buffers_to_string(_buffer.data()));
+        ASSERT_EQ(_object.as_object().at("status").as_string(), "success");
+        ASSERT_EQ(_object.as_object().at("transaction_id").as_string(), _requested_transaction_id);
+    }
+
+    ASSERT_TRUE(server_a_->get_state()->get_subscriptions().size() == 1);
+
+    boost::system::error_code ec;
+    _client.close(boost::beast::websocket::close_code::normal, ec);
+    _client.next_layer().close(ec);
+}
+
+TEST_F(server_test, server_can_drain) {
+    boost::asio::io_context _ioc;
+    boost::asio::ip::tcp::resolver _resolver{make_strand(_ioc)};
+    boost::beast::websocket::stream<boost::asio::ip::tcp::socket> _client{make_strand(_ioc)};
+
+    auto const _results = _resolver.resolve("127.0.0.1", std::to_string(server_c_->get_config()->clients_port_.load(std::memory_order_acquire)));
+    boost::asio::connect(_client.next_layer(), _results);
+
+    const auto _host = fmt::format("127.0.0.1:{}", std::to_string(server_c_->get_config()->clients_port_.load(std::memory_order_acquire)));
+    _client.handshake(_host, "/");
+
+    boost::beast::flat_buffer _accepted_buffer;
+    _client.read(_accepted_buffer);
+
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    ASSERT_EQ(server_a_->get_state()->get_remote_clients().size(), 1);
+
+    server_c_->stop();
+
+    // El cliente recibe el cierre del nodo que se drena
+    boost::beast::flat_buffer _buffer;
+    boost::system::error_code _ec;
+    _client.read(_buffer, _ec);
+
+    ASSERT_EQ(_ec, boost::beast::websocket::error::closed);
+    ASSERT_EQ(_client.reason().code, boost::beast::websocket::close_code::going_away);
+
+    while (!server_c_->get_state()->get_ioc().stopped()) {
+        LOG_INFO("waiting for drain ...");
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    ASSERT_EQ(server_a_->get_state()->get_sessions().size(), 1);
+    ASSERT_EQ(server_b_->get_state()->get_sessions().size(), 1);
+    ASSERT_TRUE(server_a_->get_state()->get_remote_clients().empty());
+    ASSERT_TRUE(server_b_->get_state()->get_remote_clients().empty());
+}
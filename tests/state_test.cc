@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 
+#include <aewt/client.hpp>
 #include <aewt/session.hpp>
 #include <aewt/state.hpp>
 
@@ -44,3 +45,147 @@ TEST(state_test, can_contains_sessions) {
     ASSERT_EQ(_state->get_sessions().size(), 0);
     ASSERT_EQ(_state->get_session(_session->get_id()), std::nullopt);
 }
+
+TEST(state_test, can_aggregate_interests) {
+    const auto _state = std::make_shared<aewt::state>();
+
+    const auto _client_a = boost::uuids::random_generator()();
+    const auto _client_b = boost::uuids::random_generator()();
+
+    _state->subscribe(_state->get_id(), _client_a, "welcome");
+    _state->subscribe(_state->get_id(), _client_b, "welcome");
+    ASSERT_EQ(_state->get_subscriptions().size(), 2);
+    ASSERT_EQ(_state->get_interests().size(), 1);
+    ASSERT_EQ(_state->get_interests().front().count_, 2);
+
+    _state->unsubscribe(_state->get_id(), _client_a, "welcome");
+    ASSERT_EQ(_state->get_interests().size(), 1);
+    ASSERT_EQ(_state->get_interests().front().count_, 1);
+
+    _state->unsubscribe(_state->get_id(), _client_b, "welcome");
+    ASSERT_EQ(_state->get_interests().size(), 0);
+}
+
+TEST(state_test, can_count_remote_subscriptions) {
+    const auto _state = std::make_shared<aewt::state>();
+
+    const auto _session_id = boost::uuids::random_generator()();
+    const auto _client_id = boost::uuids::random_generator()();
+
+    _state->push_remote_client({_client_id, _session_id});
+
+    ASSERT_TRUE(_state->subscribe(_session_id, _client_id, "welcome"));
+    ASSERT_TRUE(_state->subscribe(_session_id, boost::uuids::random_generator()(), "welcome"));
+
+    // Los clientes remotos no generan filas de suscripción.
+    ASSERT_TRUE(_state->get_subscriptions().empty());
+    ASSERT_EQ(_state->get_interests().size(), 1);
+    ASSERT_EQ(_state->get_interests().front().count_, 2);
+
+    ASSERT_TRUE(_state->is_subscribed(_client_id, "welcome"));
+    ASSERT_FALSE(_state->is_subscribed(_client_id, "goodbye"));
+
+    ASSERT_TRUE(_state->unsubscribe(_session_id, _client_id, "welcome"));
+    ASSERT_TRUE(_state->unsubscribe(_session_id, _client_id, "welcome"));
+    ASSERT_FALSE(_state->unsubscribe(_session_id, _client_id, "welcome"));
+    ASSERT_TRUE(_state->get_interests().empty());
+}
+
+TEST(state_test, can_keep_remote_clients_as_records) {
+    const auto _state = std::make_shared<aewt::state>();
+
+    const auto _session_id = boost::uuids::random_generator()();
+    const auto _client_id = boost::uuids::random_generator()();
+
+    ASSERT_TRUE(_state->push_remote_client({_client_id, _session_id}));
+    ASSERT_FALSE(_state->push_remote_client({_client_id, _session_id}));
+
+    ASSERT_TRUE(_state->get_clients().empty());
+    ASSERT_EQ(_state->get_remote_clients().size(), 1);
+    ASSERT_TRUE(_state->get_client_exists(_client_id));
+    ASSERT_EQ(_state->get_client_session(_client_id), _session_id);
+
+    _state->remove_state_of_session(_session_id);
+
+    ASSERT_FALSE(_state->get_client_exists(_client_id));
+    ASSERT_TRUE(_state->get_remote_clients().empty());
+}
+
+TEST(state_test, can_remove_subscriptions_on_disconnect) {
+    const auto _state = std::make_shared<aewt::state>();
+
+    const auto _client = std::make_shared<aewt::client>(_state->get_id(), _state);
+    const auto _other = std::make_shared<aewt::client>(_state->get_id(), _state);
+
+    _state->push_client(_client);
+    _state->push_client(_other);
+
+    _state->subscribe(_state->get_id(), _client->get_id(), "welcome");
+    _state->subscribe(_state->get_id(), _client->get_id(), "goodbye");
+    _state->subscribe(_state->get_id(), _other->get_id(), "welcome");
+
+    ASSERT_TRUE(_state->remove_client(_client->get_id()));
+
+    ASSERT_EQ(_state->get_subscriptions().size(), 1);
+    ASSERT_FALSE(_state->is_subscribed(_client->get_id(), "welcome"));
+    ASSERT_TRUE(_state->is_subscribed(_other->get_id(), "welcome"));
+
+    ASSERT_EQ(_state->get_interests().size(), 1);
+    ASSERT_EQ(_state->get_interests().front().channel_, "welcome");
+    ASSERT_EQ(_state->get_interests().front().count_, 1);
+
+    ASSERT_EQ(_state->remove_subscriptions_of_client(_other->get_id()), 1);
+    ASSERT_TRUE(_state->get_interests().empty());
+}
+
+TEST(state_test, can_match_pattern_subscriptions) {
+    const auto _state = std::make_shared<aewt::state>();
+
+    const auto _client = std::make_shared<aewt::client>(_state->get_id(), _state);
+    _state->push_client(_client);
+
+    ASSERT_TRUE(_state->subscribe(_state->get_id(), _client->get_id(), "orders.eu.*"));
+    ASSERT_TRUE(_state->is_subscribed(_client->get_id(), "orders.eu.1234"));
+    ASSERT_FALSE(_state->is_subscribed(_client->get_id(), "orders.us.1234"));
+
+    const auto _session_id = boost::uuids::random_generator()();
+    const auto _client_id = boost::uuids::random_generator()();
+
+    _state->push_remote_client({_client_id, _session_id});
+    ASSERT_EQ(_state->push_interests(_session_id, {"orders.#"}), 1);
+
+    ASSERT_TRUE(_state->is_subscribed(_client_id, "orders.us.1234"));
+    ASSERT_FALSE(_state->is_subscribed(_client_id, "invoices.us.1234"));
+
+    _state->remove_state_of_session(_session_id);
+    _state->push_remote_client({_client_id, _session_id});
+
+    ASSERT_FALSE(_state->is_subscribed(_client_id, "orders.us.1234"));
+}
+
+TEST(state_test, can_stop_advertising_when_draining) {
+    boost::asio::io_context _io_context;
+
+    const auto _state = std::make_shared<aewt::state>();
+
+    const auto _session = std::make_shared<aewt::session>(_state, boost::asio::ip::tcp::socket{_io_context});
+    _state->add_session(_session);
+
+    const auto _client = std::make_shared<aewt::client>(_state->get_id(), _state);
+    _state->push_client(_client);
+
+    ASSERT_FALSE(_state->get_draining());
+    ASSERT_EQ(_state->join_to_sessions(_client->get_id()), 1);
+
+    ASSERT_EQ(_state->drain_to_sessions(), 1);
+    ASSERT_TRUE(_state->get_draining());
+
+    // El anuncio sale una sola vez y nada más se anuncia después
+    ASSERT_EQ(_state->drain_to_sessions(), 0);
+    ASSERT_EQ(_state->join_to_sessions(_client->get_id()), 0);
+    ASSERT_EQ(_state->leave_to_sessions(_client->get_id()), 0);
+    ASSERT_EQ(_state->interest_to_sessions({"welcome"}, {}), 0);
+    ASSERT_EQ(_state->digest_to_sessions(), 0);
+
+    _state->remove_session(_session->get_id());
+}
@@ -0,0 +1,90 @@
+// Copyright (C) 2025 Ian Torres <iantorres@outlook.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include <gtest/gtest.h>
+
+#include <aewt/kernel.hpp>
+#include <aewt/kernel_context.hpp>
+#include <aewt/response.hpp>
+#include <aewt/session.hpp>
+#include <aewt/client.hpp>
+#include <aewt/state.hpp>
+#include <aewt/logger.hpp>
+#include <boost/json/serialize.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <boost/uuid/uuid_io.hpp>
+
+#include "../helpers.hpp"
+
+using namespace aewt;
+
+TEST(validators_batch_validator_test, can_handle_wrong_params_requests_on_batch) {
+    const auto _state = std::make_shared<aewt::state>();
+
+    const auto _local_client = std::make_shared<aewt::client>(_state->get_id(), _state);
+
+    const std::vector<std::pair<boost::json::object, const char *> > _cases = {
+        {{}, "params requests attribute must be present"},
+        {{{"requests", "ping"}}, "params requests attribute must be array"},
+        {{{"requests", {7}}}, "params requests attribute must contain objects"},
+        {{{"requests", {{{"action", "batch"}}}}}, "params requests attribute must not contain batches"},
+        {{{"requests", boost::json::array{}}, {"stream", "yes"}}, "params stream attribute must be boolean"},
+    };
+
+    for (const auto &[_params, _message]: _cases) {
+        const auto _transaction_id = boost::uuids::random_generator()();
+        const boost::json::object _data = {
+            {"action", "batch"}, {"transaction_id", to_string(_transaction_id)}, {"params", _params}
+        };
+
+        const auto _response = kernel(_state, _data, on_client, _local_client->get_id());
+
+        LOG_INFO("response processed={} failed={} data={}", _response->get_processed(), _response->get_failed(),
+                 serialize(_response->get_data()));
+
+        ASSERT_TRUE(_response->get_processed());
+        ASSERT_TRUE(_response->get_failed());
+
+        test_response_base_protocol_structure(_response, "failed", "unprocessable entity", _transaction_id);
+
+        ASSERT_EQ(_response->get_data().at("data").as_object().at("params").as_string(), _message);
+    }
+}
+
+TEST(validators_batch_validator_test, can_handle_batch_over_limit) {
+    const auto _config = std::make_shared<aewt::config>();
+    _config->batch_limit_ = 1;
+
+    const auto _state = std::make_shared<aewt::state>(_config);
+
+    const auto _local_client = std::make_shared<aewt::client>(_state->get_id(), _state);
+
+    const auto _transaction_id = boost::uuids::random_generator()();
+    const boost::json::object _data = {
+        {"action", "batch"}, {"transaction_id", to_string(_transaction_id)}, {
+            "params", {
+                {"requests", boost::json::array{boost::json::object{}, boost::json::object{}}},
+            }
+        }
+    };
+
+    const auto _response = kernel(_state, _data, on_client, _local_client->get_id());
+
+    ASSERT_TRUE(_response->get_processed());
+    ASSERT_TRUE(_response->get_failed());
+
+    ASSERT_EQ(_response->get_data().at("data").as_object().at("params").as_string(),
+              "params requests attribute exceeds the batch limit");
+}
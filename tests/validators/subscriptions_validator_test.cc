@@ -102,3 +102,31 @@ TEST(validators_subscriptions_validator_test, can_handle_wrong_params_channel_pr
                   "params channel attribute must be string");
     }
 }
+
+TEST(validators_subscriptions_validator_test, can_handle_wrong_params_since_on_subscriptions) {
+    const auto _state = std::make_shared<aewt::state>();
+
+    const auto _local_client = std::make_shared<aewt::client>(_state->get_id(), _state);
+
+    for (const boost::json::value _since: {boost::json::value("1"), boost::json::value(-1)}) {
+        const auto _transaction_id = boost::uuids::random_generator()();
+        const boost::json::object _data = {
+            {"action", "subscribe"}, {"transaction_id", to_string(_transaction_id)}, {
+                "params", {
+                    {"channel", "welcome"},
+                    {"since", _since},
+                }
+            }
+        };
+
+        const auto _response = kernel(_state, _data, on_client, _local_client->get_id());
+
+        ASSERT_TRUE(_response->get_processed());
+        ASSERT_TRUE(_response->get_failed());
+
+        test_response_base_protocol_structure(_response, "failed", "unprocessable entity", _transaction_id);
+
+        ASSERT_EQ(_response->get_data().at("data").as_object().at("params").as_string(),
+                  "params since attribute must be a positive number");
+    }
+}